@@ -17,7 +17,8 @@ enum class ErrorCode {
     InvalidIndices,
     NegativeCount,
     NullList,
-    ConcatTypeMismatch
+    ConcatTypeMismatch,
+    IoError
 };
 
 inline const char* toMessage(ErrorCode code) {
@@ -35,6 +36,7 @@ inline const char* toMessage(ErrorCode code) {
         case ErrorCode::NegativeCount: return "Negative count";
         case ErrorCode::NullList: return "Null list";
         case ErrorCode::ConcatTypeMismatch: return "Cannot concat sequences of different types";
+        case ErrorCode::IoError: return "I/O error";
         default: return "Unknown error";
     }
 }
@@ -117,4 +119,8 @@ namespace Errors {
     inline BaseError concatTypeMismatch(const std::string& msg = "") {
         return make(ErrorCode::ConcatTypeMismatch, msg);
     }
+
+    inline BaseError ioError(const std::string& msg = "") {
+        return make(ErrorCode::IoError, msg);
+    }
 }
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+enum class AllocationPolicy {
+    Aligned,
+    TransparentHugePages,
+    HugeTlb
+};
+
+inline const char* toString(AllocationPolicy policy) {
+    switch (policy) {
+        case AllocationPolicy::Aligned: return "aligned";
+        case AllocationPolicy::TransparentHugePages: return "transparent huge pages";
+        case AllocationPolicy::HugeTlb: return "hugetlb";
+        default: return "unknown";
+    }
+}
+
+// Выдаёт память, выровненную на Alignment байт (по умолчанию на кэш-линию).
+// Блоки от hugePageThreshold байт и больше на Linux берутся через mmap:
+// с MAP_HUGETLB, если он запрошен и доступен, иначе с madvise(MADV_HUGEPAGE);
+// при любой неудаче используется обычное выровненное выделение.
+// Политика последнего выделения доступна через getLastPolicy().
+template <typename T, std::size_t Alignment = 64>
+class AlignedAllocator {
+private:
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must not be weaker than alignof(T)");
+
+    template <typename U, std::size_t A>
+    friend class AlignedAllocator;
+
+    struct Header {
+        AllocationPolicy policy;
+        std::size_t mappedBytes;
+    };
+
+    static constexpr std::size_t HEADER_SIZE = (sizeof(Header) + Alignment - 1) / Alignment * Alignment;
+    static constexpr std::size_t HUGE_PAGE_SIZE = std::size_t(2) << 20;
+
+    std::size_t hugePageThreshold;
+    bool useHugeTlb;
+    AllocationPolicy lastPolicy;
+
+    static void* allocateAligned(std::size_t bytes) {
+        return ::operator new(bytes, std::align_val_t(Alignment));
+    }
+
+    static void deallocateAligned(void* block) {
+        ::operator delete(block, std::align_val_t(Alignment));
+    }
+
+    // Крупные блоки несут заголовок, чтобы deallocate знал, как их вернуть
+    void* allocateLarge(std::size_t bytes) {
+        std::size_t total = HEADER_SIZE + bytes;
+        void* block = nullptr;
+        Header header{AllocationPolicy::Aligned, 0};
+
+#if defined(__linux__)
+#if defined(MAP_HUGETLB)
+        if (useHugeTlb) {
+            std::size_t length = (total + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+            void* mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (mapped != MAP_FAILED) {
+                block = mapped;
+                header = {AllocationPolicy::HugeTlb, length};
+            }
+        }
+#endif
+#if defined(MADV_HUGEPAGE)
+        if (!block) {
+            void* mapped = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped != MAP_FAILED) {
+                if (madvise(mapped, total, MADV_HUGEPAGE) == 0) {
+                    block = mapped;
+                    header = {AllocationPolicy::TransparentHugePages, total};
+                } else {
+                    munmap(mapped, total);
+                }
+            }
+        }
+#endif
+#endif
+        if (!block)
+            block = allocateAligned(total);
+
+        ::new (block) Header(header);
+        lastPolicy = header.policy;
+        return static_cast<unsigned char*>(block) + HEADER_SIZE;
+    }
+
+    static void deallocateLarge(void* pointer) {
+        void* block = static_cast<unsigned char*>(pointer) - HEADER_SIZE;
+        Header header = *static_cast<Header*>(block);
+#if defined(__linux__)
+        if (header.policy != AllocationPolicy::Aligned) {
+            munmap(block, header.mappedBytes);
+            return;
+        }
+#endif
+        deallocateAligned(block);
+    }
+
+public:
+    using value_type = T;
+
+    static constexpr std::size_t DEFAULT_HUGE_PAGE_THRESHOLD = std::size_t(4) << 20;
+
+    AlignedAllocator() noexcept
+        : hugePageThreshold(DEFAULT_HUGE_PAGE_THRESHOLD), useHugeTlb(false),
+          lastPolicy(AllocationPolicy::Aligned) {}
+
+    // hugePageThreshold == 0 отключает mmap полностью
+    explicit AlignedAllocator(std::size_t hugePageThreshold, bool useHugeTlb = false) noexcept
+        : hugePageThreshold(hugePageThreshold), useHugeTlb(useHugeTlb),
+          lastPolicy(AllocationPolicy::Aligned) {}
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>& other) noexcept
+        : hugePageThreshold(other.hugePageThreshold), useHugeTlb(other.useHugeTlb),
+          lastPolicy(other.lastPolicy) {}
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    T* allocate(std::size_t count) {
+        std::size_t bytes = sizeof(T) * count;
+        if (hugePageThreshold != 0 && bytes >= hugePageThreshold)
+            return static_cast<T*>(allocateLarge(bytes));
+        lastPolicy = AllocationPolicy::Aligned;
+        return static_cast<T*>(allocateAligned(bytes));
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept {
+        std::size_t bytes = sizeof(T) * count;
+        if (hugePageThreshold != 0 && bytes >= hugePageThreshold)
+            deallocateLarge(pointer);
+        else
+            deallocateAligned(pointer);
+    }
+
+    AllocationPolicy getLastPolicy() const noexcept {
+        return lastPolicy;
+    }
+
+    std::size_t getHugePageThreshold() const noexcept {
+        return hugePageThreshold;
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>& other) const noexcept {
+        return hugePageThreshold == other.hugePageThreshold;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>& other) const noexcept {
+        return !(*this == other);
+    }
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include "errors.hpp"
+
+// Монотонная арена: память выдаётся сдвигом указателя внутри крупных блоков,
+// отдельные освобождения игнорируются, всё возвращается разом через release().
+// Арена не потокобезопасна и должна пережить все контейнеры, которые из неё берут память.
+class MonotonicArena {
+private:
+    struct Block {
+        Block* previous;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4096;
+    static constexpr std::size_t MAX_BLOCK_SIZE = std::size_t(1) << 26;
+
+    Block* head;
+    unsigned char* cursor;
+    unsigned char* end;
+    std::size_t nextBlockSize;
+    std::size_t bytesAllocated;
+    std::size_t bytesReserved;
+
+    static constexpr std::size_t HEADER_SIZE =
+        (sizeof(Block) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    void addBlock(std::size_t minimumSize, std::size_t alignment) {
+        std::size_t payload = std::max(nextBlockSize, minimumSize + alignment);
+        auto* raw = static_cast<unsigned char*>(::operator new(HEADER_SIZE + payload));
+        Block* block = reinterpret_cast<Block*>(raw);
+        block->previous = head;
+        block->size = HEADER_SIZE + payload;
+        head = block;
+        cursor = raw + HEADER_SIZE;
+        end = cursor + payload;
+        bytesReserved += block->size;
+        nextBlockSize = std::min(nextBlockSize * 2, MAX_BLOCK_SIZE);
+    }
+
+public:
+    explicit MonotonicArena(std::size_t initialBlockSize = DEFAULT_BLOCK_SIZE)
+        : head(nullptr), cursor(nullptr), end(nullptr),
+          nextBlockSize(std::max<std::size_t>(initialBlockSize, 64)),
+          bytesAllocated(0), bytesReserved(0) {}
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena() {
+        release();
+    }
+
+    void* allocate(std::size_t bytes, std::size_t alignment) {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+            throw Errors::invalidArgument("Alignment must be a power of two");
+
+        auto address = reinterpret_cast<std::uintptr_t>(cursor);
+        std::size_t padding = (alignment - address % alignment) % alignment;
+        if (!cursor || padding + bytes > static_cast<std::size_t>(end - cursor)) {
+            addBlock(bytes, alignment);
+            address = reinterpret_cast<std::uintptr_t>(cursor);
+            padding = (alignment - address % alignment) % alignment;
+        }
+
+        void* result = cursor + padding;
+        cursor += padding + bytes;
+        bytesAllocated += bytes;
+        return result;
+    }
+
+    // Все выданные указатели становятся недействительными
+    void release() {
+        while (head) {
+            Block* previous = head->previous;
+            ::operator delete(head);
+            head = previous;
+        }
+        cursor = end = nullptr;
+        bytesAllocated = 0;
+        bytesReserved = 0;
+    }
+
+    std::size_t getBytesAllocated() const {
+        return bytesAllocated;
+    }
+
+    std::size_t getBytesReserved() const {
+        return bytesReserved;
+    }
+};
+
+// Аллокатор в стиле std::allocator поверх MonotonicArena: deallocate ничего не делает
+template <typename T>
+class ArenaAllocator {
+private:
+    MonotonicArena* arena;
+
+    template <typename U>
+    friend class ArenaAllocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit ArenaAllocator(MonotonicArena& arena) noexcept : arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(arena->allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    MonotonicArena& getArena() const noexcept {
+        return *arena;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return arena != other.arena;
+    }
+};
@@ -0,0 +1,797 @@
+#pragma once
+
+#include "errors.hpp"
+#include "dynamic_array.hpp"
+#include "node_pool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Двусвязный список, все узлы которого лежат в одном DynamicArray
+// и ссылаются друг на друга 32-битными индексами. Освобождённые ячейки
+// уходят в свободный список внутри того же массива.
+// Интерфейс совпадает с LinkedList, поэтому список можно подставить
+// в MutableListSequence и адаптеры. Для тривиально копируемых T
+// весь список копируется одним memcpy
+template <typename T, typename Allocator = std::allocator<T>>
+class CompactLinkedList {
+public:
+    using allocator_type = Allocator;
+
+private:
+    using Link = std::uint32_t;
+    static constexpr Link NIL = static_cast<Link>(-1);
+
+    // В свободной ячейке остаётся перемещённый элемент, а next ведёт по свободному списку
+    struct Slot {
+        T data;
+        Link prev;
+        Link next;
+        template <typename... Args>
+        explicit Slot(Link prevSlot, Link nextSlot, Args&&... args)
+            : data(std::forward<Args>(args)...), prev(prevSlot), next(nextSlot) {}
+    };
+
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+
+    DynamicArray<Slot, SlotAllocator> nodes;
+    Link head;
+    Link tail;
+    Link freeHead;
+    int size;
+
+    // Как курсор в LinkedList
+    mutable Link cursor;
+    mutable int cursorIndex;
+
+    // Как в LinkedList, только соседство считается по индексам ячеек:
+    // связь рассеяна, если следующий узел лежит не в соседней ячейке
+    int scatteredLinks;
+    double compactionThreshold;
+
+    static int scattered(Link from, Link to) { return to != from + 1; }
+    void compactIfFragmented();
+
+    Slot& slot(Link index) { return nodes.data()[index]; }
+    const Slot& slot(Link index) const { return nodes.data()[index]; }
+
+    template <typename... Args>
+    Link createSlot(Link prev, Link next, Args&&... args);
+    void releaseSlot(Link index);
+    void linkBack(Link index);
+    Link nodeAt(int index) const;
+
+    Link cutChain(Link first, int count);
+    Link* appendChain(Link* out, Link chain);
+    void restoreBackLinks();
+
+    void copyLinks(const CompactLinkedList& other);
+    void resetLinks() noexcept;
+
+    template <bool Const>
+    class BasicIterator {
+    private:
+        using SlotPointer = std::conditional_t<Const, const Slot*, Slot*>;
+        SlotPointer slots;
+        Link index;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const T*, T*>;
+        using reference         = std::conditional_t<Const, const T&, T&>;
+
+        explicit BasicIterator(SlotPointer slots = nullptr, Link index = NIL) : slots(slots), index(index) {}
+
+        reference operator*() const { return slots[index].data; }
+        pointer operator->() const { return &slots[index].data; }
+
+        BasicIterator& operator++() {
+            index = slots[index].next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            index = slots[index].next;
+            return previous;
+        }
+
+        bool operator==(const BasicIterator& other) const { return index == other.index; }
+        bool operator!=(const BasicIterator& other) const { return index != other.index; }
+    };
+
+public:
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    CompactLinkedList();
+    explicit CompactLinkedList(const Allocator& allocator);
+    CompactLinkedList(T* items, int count, const Allocator& allocator = Allocator());
+    CompactLinkedList(const CompactLinkedList& other);
+    CompactLinkedList(CompactLinkedList&& other) noexcept;
+
+    CompactLinkedList& operator=(const CompactLinkedList& other);
+    CompactLinkedList& operator=(CompactLinkedList&& other);
+
+    T getFirst() const;
+    T getLast() const;
+    T get(int index) const;
+
+    T& operator[](int index);
+    const T& operator[](int index) const;
+
+    int getLength() const;
+    Allocator getAllocator() const;
+    // Весь список занимает один блок: slabs равно 0 или 1
+    PoolStats getPoolStats() const;
+
+    iterator begin() { return iterator(nodes.data(), head); }
+    iterator end() { return iterator(nodes.data()); }
+    const_iterator begin() const { return const_iterator(nodes.data(), head); }
+    const_iterator end() const { return const_iterator(nodes.data()); }
+
+    void reserve(int capacity);
+
+    void append(T item);
+    void prepend(T item);
+    void insertAt(T item, int index);
+
+    template <typename... Args>
+    T& emplaceBack(Args&&... args);
+    template <typename... Args>
+    T& emplaceFront(Args&&... args);
+
+    void remove(int index);
+    void clear();
+
+    // Пакетные операции, как в LinkedList
+    template <typename ForwardIt>
+    void insertRange(int index, ForwardIt first, ForwardIt last);
+    void removeRange(int startIndex, int endIndex);
+    template <typename Predicate>
+    int removeIf(Predicate predicate);
+
+    // Переставляет ячейки в порядке обхода и отбрасывает свободные
+    void compact();
+    // Доля связей между несоседними ячейками: 0 сразу после compact()
+    double getFragmentation() const;
+    // Порог автоматического compact(), как в LinkedList
+    void setCompactionThreshold(double threshold);
+
+    // Узлы живут в массиве этого списка, поэтому элементы other переносятся
+    // по одному; в пустой список массив other забирается целиком
+    void splice(CompactLinkedList&& other);
+
+    template <typename Compare = std::less<>>
+    void sort(Compare less = Compare());
+
+    CompactLinkedList* getSubList(int startIndex, int endIndex) const;
+    CompactLinkedList* clone() const;
+    CompactLinkedList* concat(const CompactLinkedList* other) const;
+    CompactLinkedList* concat(CompactLinkedList&& other) const;
+
+    bool operator==(const CompactLinkedList& other) const;
+    bool operator!=(const CompactLinkedList& other) const;
+};
+
+template <typename T, typename A>
+CompactLinkedList<T, A>::CompactLinkedList() : CompactLinkedList(A()) {}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>::CompactLinkedList(const A& allocator)
+    : nodes(SlotAllocator(allocator)), head(NIL), tail(NIL), freeHead(NIL), size(0),
+      cursor(NIL), cursorIndex(0), scatteredLinks(0), compactionThreshold(0) {}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>::CompactLinkedList(T* items, int count, const A& allocator)
+    : CompactLinkedList(allocator) {
+    if (count < 0) throw Errors::negativeCount();
+    nodes.reserve(count);
+    for (int i = 0; i < count; ++i)
+        append(items[i]);
+}
+
+// Массив копируется вместе со свободными ячейками, индексы остаются верными
+template <typename T, typename A>
+CompactLinkedList<T, A>::CompactLinkedList(const CompactLinkedList& other)
+    : nodes(other.nodes), compactionThreshold(other.compactionThreshold) {
+    copyLinks(other);
+}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>::CompactLinkedList(CompactLinkedList&& other) noexcept
+    : nodes(std::move(other.nodes)), compactionThreshold(other.compactionThreshold) {
+    copyLinks(other);
+    other.resetLinks();
+}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>& CompactLinkedList<T, A>::operator=(const CompactLinkedList& other) {
+    if (this != &other) {
+        nodes = other.nodes;
+        copyLinks(other);
+        compactionThreshold = other.compactionThreshold;
+    }
+    return *this;
+}
+
+// При разных аллокаторах DynamicArray переносит ячейки поэлементно, индексы не меняются
+template <typename T, typename A>
+CompactLinkedList<T, A>& CompactLinkedList<T, A>::operator=(CompactLinkedList&& other) {
+    if (this != &other) {
+        nodes = std::move(other.nodes);
+        copyLinks(other);
+        compactionThreshold = other.compactionThreshold;
+        other.nodes.clear();
+        other.resetLinks();
+    }
+    return *this;
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::copyLinks(const CompactLinkedList& other) {
+    head = other.head;
+    tail = other.tail;
+    freeHead = other.freeHead;
+    size = other.size;
+    cursor = other.cursor;
+    cursorIndex = other.cursorIndex;
+    scatteredLinks = other.scatteredLinks;
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::resetLinks() noexcept {
+    head = tail = freeHead = cursor = NIL;
+    size = cursorIndex = scatteredLinks = 0;
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename CompactLinkedList<T, A>::Link CompactLinkedList<T, A>::createSlot(Link prev, Link next, Args&&... args) {
+    if (freeHead == NIL) {
+        nodes.emplaceBack(prev, next, std::forward<Args>(args)...);
+        return static_cast<Link>(nodes.getSize() - 1);
+    }
+
+    T value(std::forward<Args>(args)...);
+    Link index = freeHead;
+    Slot& reused = slot(index);
+    freeHead = reused.next;
+    reused.data = std::move(value);
+    reused.prev = prev;
+    reused.next = next;
+    return index;
+}
+
+// Элемент уничтожается сразу, в ячейке остаётся только перемещённый объект
+template <typename T, typename A>
+void CompactLinkedList<T, A>::releaseSlot(Link index) {
+    Slot& released = slot(index);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        T discarded(std::move(released.data));
+    }
+    released.next = freeHead;
+    freeHead = index;
+}
+
+template <typename T, typename A>
+T CompactLinkedList<T, A>::getFirst() const {
+    if (head == NIL) throw Errors::emptyList();
+    return slot(head).data;
+}
+
+template <typename T, typename A>
+T CompactLinkedList<T, A>::getLast() const {
+    if (tail == NIL) throw Errors::emptyList();
+    return slot(tail).data;
+}
+
+template <typename T, typename A>
+typename CompactLinkedList<T, A>::Link CompactLinkedList<T, A>::nodeAt(int index) const {
+    Link current = head;
+    int position = 0;
+    if (size - 1 - index < index) {
+        current = tail;
+        position = size - 1;
+    }
+    if (cursor != NIL && std::abs(index - cursorIndex) < std::abs(index - position)) {
+        current = cursor;
+        position = cursorIndex;
+    }
+
+    for (; position < index; ++position)
+        current = slot(current).next;
+    for (; position > index; --position)
+        current = slot(current).prev;
+
+    cursor = current;
+    cursorIndex = index;
+    return current;
+}
+
+template <typename T, typename A>
+T CompactLinkedList<T, A>::get(int index) const {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("Index: " + std::to_string(index));
+    return slot(nodeAt(index)).data;
+}
+
+template <typename T, typename A>
+T& CompactLinkedList<T, A>::operator[](int index) {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+    return slot(nodeAt(index)).data;
+}
+
+template <typename T, typename A>
+const T& CompactLinkedList<T, A>::operator[](int index) const {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+    return slot(nodeAt(index)).data;
+}
+
+template <typename T, typename A>
+int CompactLinkedList<T, A>::getLength() const {
+    return size;
+}
+
+template <typename T, typename A>
+A CompactLinkedList<T, A>::getAllocator() const {
+    return A(nodes.getAllocator());
+}
+
+template <typename T, typename A>
+PoolStats CompactLinkedList<T, A>::getPoolStats() const {
+    return PoolStats{nodes.getCapacity() > 0 ? 1 : 0, nodes.getCapacity(), size};
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::reserve(int capacity) {
+    nodes.reserve(capacity);
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::linkBack(Link index) {
+    if (head == NIL) {
+        head = tail = index;
+    } else {
+        slot(index).prev = tail;
+        slot(tail).next = index;
+        scatteredLinks += scattered(tail, index);
+        tail = index;
+    }
+    ++size;
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::append(T item) {
+    linkBack(createSlot(NIL, NIL, std::move(item)));
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::prepend(T item) {
+    emplaceFront(std::move(item));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+T& CompactLinkedList<T, A>::emplaceBack(Args&&... args) {
+    linkBack(createSlot(NIL, NIL, std::forward<Args>(args)...));
+    return slot(tail).data;
+}
+
+template <typename T, typename A>
+template <typename... Args>
+T& CompactLinkedList<T, A>::emplaceFront(Args&&... args) {
+    Link index = createSlot(NIL, head, std::forward<Args>(args)...);
+    if (head != NIL) {
+        slot(head).prev = index;
+        scatteredLinks += scattered(index, head);
+    } else {
+        tail = index;
+    }
+    head = index;
+    ++size;
+    if (cursor != NIL) ++cursorIndex;
+    return slot(head).data;
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::insertAt(T item, int index) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+    if (index == 0) {
+        prepend(std::move(item));
+        return;
+    }
+    if (index == size) {
+        append(std::move(item));
+        return;
+    }
+
+    Link next = nodeAt(index);
+    Link prev = slot(next).prev;
+    Link inserted = createSlot(prev, next, std::move(item));
+    slot(prev).next = inserted;
+    slot(next).prev = inserted;
+    scatteredLinks += scattered(prev, inserted) + scattered(inserted, next) - scattered(prev, next);
+    ++size;
+    cursor = inserted;
+    compactIfFragmented();
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::remove(int index) {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("Remove index: " + std::to_string(index));
+
+    Link removed = nodeAt(index);
+    Link prev = slot(removed).prev;
+    Link next = slot(removed).next;
+    if (prev != NIL)
+        scatteredLinks -= scattered(prev, removed);
+    if (next != NIL)
+        scatteredLinks -= scattered(removed, next);
+    if (prev != NIL && next != NIL)
+        scatteredLinks += scattered(prev, next);
+
+    if (prev != NIL)
+        slot(prev).next = next;
+    else
+        head = next;
+    if (next != NIL)
+        slot(next).prev = prev;
+    else
+        tail = prev;
+
+    if (next != NIL) {
+        cursor = next;
+    } else {
+        cursor = prev;
+        --cursorIndex;
+    }
+    releaseSlot(removed);
+    --size;
+    compactIfFragmented();
+}
+
+// Ёмкость массива сохраняется для следующих вставок
+template <typename T, typename A>
+void CompactLinkedList<T, A>::clear() {
+    nodes.clear();
+    resetLinks();
+}
+
+// Элементы сначала копируются во временный массив: заведение ячеек может
+// перевыделить nodes, а диапазон может указывать в сам список.
+// Новые ячейки подвешиваются одной цепочкой; если перенос элемента бросит исключение,
+// они возвращаются в свободный список, и список не меняется
+template <typename T, typename A>
+template <typename ForwardIt>
+void CompactLinkedList<T, A>::insertRange(int index, ForwardIt first, ForwardIt last) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+    if (first == last) return;
+
+    DynamicArray<T, A> items(getAllocator());
+    items.insertRange(0, first, last);
+    int count = items.getSize();
+    int freeSlots = nodes.getSize() - size;
+    if (count > freeSlots)
+        reserve(nodes.getSize() + count - freeSlots);
+
+    Link chainHead = NIL;
+    Link chainTail = NIL;
+    int chainScattered = 0;
+    try {
+        for (T& item : items) {
+            Link created = createSlot(chainTail, NIL, std::move_if_noexcept(item));
+            if (chainTail != NIL) {
+                slot(chainTail).next = created;
+                chainScattered += scattered(chainTail, created);
+            } else {
+                chainHead = created;
+            }
+            chainTail = created;
+        }
+    } catch (...) {
+        while (chainHead != NIL) {
+            Link next = slot(chainHead).next;
+            releaseSlot(chainHead);
+            chainHead = next;
+        }
+        throw;
+    }
+
+    Link next = index == size ? NIL : nodeAt(index);
+    Link before = next != NIL ? slot(next).prev : tail;
+    if (before != NIL && next != NIL)
+        chainScattered -= scattered(before, next);
+    if (before != NIL) {
+        slot(before).next = chainHead;
+        slot(chainHead).prev = before;
+        chainScattered += scattered(before, chainHead);
+    } else {
+        head = chainHead;
+    }
+    if (next != NIL) {
+        slot(next).prev = chainTail;
+        slot(chainTail).next = next;
+        chainScattered += scattered(chainTail, next);
+    } else {
+        tail = chainTail;
+    }
+
+    scatteredLinks += chainScattered;
+    size += count;
+    cursor = chainHead;
+    cursorIndex = index;
+    compactIfFragmented();
+}
+
+// Удаляет полуинтервал [startIndex, endIndex), как LinkedList::removeRange
+template <typename T, typename A>
+void CompactLinkedList<T, A>::removeRange(int startIndex, int endIndex) {
+    if (startIndex < 0 || endIndex > size || startIndex > endIndex)
+        throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                     ", End: " + std::to_string(endIndex));
+    if (startIndex == endIndex) return;
+    if (endIndex - startIndex == size) {
+        clear();
+        return;
+    }
+
+    Link current = nodeAt(startIndex);
+    Link before = slot(current).prev;
+    if (before != NIL)
+        scatteredLinks -= scattered(before, current);
+    for (int i = startIndex; i < endIndex; ++i) {
+        Link next = slot(current).next;
+        if (next != NIL)
+            scatteredLinks -= scattered(current, next);
+        releaseSlot(current);
+        current = next;
+    }
+
+    if (before != NIL && current != NIL)
+        scatteredLinks += scattered(before, current);
+    if (before != NIL)
+        slot(before).next = current;
+    else
+        head = current;
+    if (current != NIL)
+        slot(current).prev = before;
+    else
+        tail = before;
+
+    size -= endIndex - startIndex;
+    cursor = current != NIL ? current : before;
+    cursorIndex = current != NIL ? startIndex : startIndex - 1;
+    compactIfFragmented();
+}
+
+// Как LinkedList::removeIf: ячейка отцепляется сразу,
+// так что исключение из predicate оставляет список целым
+template <typename T, typename A>
+template <typename Predicate>
+int CompactLinkedList<T, A>::removeIf(Predicate predicate) {
+    int removed = 0;
+    cursor = NIL;
+    Link current = head;
+    while (current != NIL) {
+        Link next = slot(current).next;
+        if (predicate(slot(current).data)) {
+            Link before = slot(current).prev;
+            if (before != NIL)
+                scatteredLinks -= scattered(before, current);
+            if (next != NIL)
+                scatteredLinks -= scattered(current, next);
+            if (before != NIL && next != NIL)
+                scatteredLinks += scattered(before, next);
+
+            if (before != NIL)
+                slot(before).next = next;
+            else
+                head = next;
+            if (next != NIL)
+                slot(next).prev = before;
+            else
+                tail = before;
+            releaseSlot(current);
+            --size;
+            ++removed;
+        }
+        current = next;
+    }
+    if (size == 0)
+        clear();
+    compactIfFragmented();
+    return removed;
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::compact() {
+    DynamicArray<Slot, SlotAllocator> packed(nodes.getAllocator());
+    packed.reserve(size);
+    int position = 0;
+    for (Link current = head; current != NIL; current = slot(current).next, ++position) {
+        Link prev = position > 0 ? static_cast<Link>(position - 1) : NIL;
+        Link next = position + 1 < size ? static_cast<Link>(position + 1) : NIL;
+        packed.emplaceBack(prev, next, std::move_if_noexcept(slot(current).data));
+    }
+
+    nodes = std::move(packed);
+    head = size > 0 ? 0 : NIL;
+    tail = size > 0 ? static_cast<Link>(size - 1) : NIL;
+    freeHead = cursor = NIL;
+    scatteredLinks = 0;
+}
+
+template <typename T, typename A>
+double CompactLinkedList<T, A>::getFragmentation() const {
+    if (size < 2) return 0.0;
+    return static_cast<double>(scatteredLinks) / (size - 1);
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::setCompactionThreshold(double threshold) {
+    compactionThreshold = threshold;
+    compactIfFragmented();
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::compactIfFragmented() {
+    constexpr int MIN_AUTO_COMPACT_SIZE = 64;
+    if (compactionThreshold > 0 && size >= MIN_AUTO_COMPACT_SIZE &&
+        getFragmentation() > compactionThreshold)
+        compact();
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::splice(CompactLinkedList&& other) {
+    if (this == &other || other.size == 0)
+        return;
+
+    if (size == 0) {
+        double threshold = compactionThreshold;
+        *this = std::move(other);
+        compactionThreshold = threshold;
+        return;
+    }
+
+    reserve(nodes.getSize() + other.size);
+    for (T& item : other)
+        emplaceBack(std::move(item));
+    other.clear();
+}
+
+template <typename T, typename A>
+typename CompactLinkedList<T, A>::Link CompactLinkedList<T, A>::cutChain(Link first, int count) {
+    for (int i = 1; first != NIL && i < count; ++i)
+        first = slot(first).next;
+    if (first == NIL) return NIL;
+    Link rest = slot(first).next;
+    slot(first).next = NIL;
+    return rest;
+}
+
+template <typename T, typename A>
+typename CompactLinkedList<T, A>::Link* CompactLinkedList<T, A>::appendChain(Link* out, Link chain) {
+    *out = chain;
+    while (*out != NIL)
+        out = &slot(*out).next;
+    return out;
+}
+
+template <typename T, typename A>
+void CompactLinkedList<T, A>::restoreBackLinks() {
+    Link previous = NIL;
+    scatteredLinks = 0;
+    for (Link current = head; current != NIL; current = slot(current).next) {
+        slot(current).prev = previous;
+        if (previous != NIL)
+            scatteredLinks += scattered(previous, current);
+        previous = current;
+    }
+    tail = previous;
+    cursor = NIL;
+}
+
+// Та же сортировка слиянием, что и в LinkedList, только по индексам
+template <typename T, typename A>
+template <typename Compare>
+void CompactLinkedList<T, A>::sort(Compare less) {
+    if (size < 2) return;
+
+    for (int width = 1; width < size; width *= 2) {
+        Link merged = NIL;
+        Link* out = &merged;
+        Link rest = head;
+        while (rest != NIL) {
+            Link left = rest;
+            Link right = cutChain(left, width);
+            rest = cutChain(right, width);
+            try {
+                while (left != NIL && right != NIL) {
+                    Link& smaller = less(slot(right).data, slot(left).data) ? right : left;
+                    *out = smaller;
+                    smaller = slot(smaller).next;
+                    out = &slot(*out).next;
+                }
+            } catch (...) {
+                out = appendChain(out, left);
+                out = appendChain(out, right);
+                appendChain(out, rest);
+                head = merged;
+                restoreBackLinks();
+                throw;
+            }
+            out = appendChain(out, left != NIL ? left : right);
+        }
+        head = merged;
+    }
+    restoreBackLinks();
+}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>* CompactLinkedList<T, A>::getSubList(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
+        throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                     ", End: " + std::to_string(endIndex));
+
+    auto* result = new CompactLinkedList(getAllocator());
+    result->reserve(endIndex - startIndex + 1);
+    Link current = nodeAt(startIndex);
+    for (int i = startIndex; i <= endIndex; ++i) {
+        result->append(slot(current).data);
+        current = slot(current).next;
+    }
+    return result;
+}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>* CompactLinkedList<T, A>::clone() const {
+    return new CompactLinkedList(*this);
+}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>* CompactLinkedList<T, A>::concat(const CompactLinkedList* other) const {
+    if (!other) throw Errors::nullList();
+    auto* result = new CompactLinkedList(*this);
+    result->reserve(nodes.getSize() + other->size);
+    for (const T& item : *other)
+        result->append(item);
+    return result;
+}
+
+template <typename T, typename A>
+CompactLinkedList<T, A>* CompactLinkedList<T, A>::concat(CompactLinkedList&& other) const {
+    auto* result = new CompactLinkedList(*this);
+    result->splice(std::move(other));
+    return result;
+}
+
+template <typename T, typename A>
+bool CompactLinkedList<T, A>::operator==(const CompactLinkedList& other) const {
+    if (size != other.size) return false;
+    Link a = head;
+    Link b = other.head;
+    while (a != NIL && b != NIL) {
+        if (slot(a).data != other.slot(b).data) return false;
+        a = slot(a).next;
+        b = other.slot(b).next;
+    }
+    return true;
+}
+
+template <typename T, typename A>
+bool CompactLinkedList<T, A>::operator!=(const CompactLinkedList& other) const {
+    return !(*this == other);
+}
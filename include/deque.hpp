@@ -6,59 +6,87 @@
 #include <stdexcept>
 #include <memory>
 
-template <typename T>
+template <typename T, typename List = LinkedList<T>>
 class Deque {
+public:
+    using Allocator = typename List::allocator_type;
+
 private:
-    MutableListSequence<T> sequence;
+    MutableListSequence<T, List> sequence;
 
-    static MutableListSequence<T> convertSequence(const Sequence<T>* seq) {
-        if (auto derived = dynamic_cast<const MutableListSequence<T>*>(seq)) {
+    static MutableListSequence<T, List> convertSequence(const Sequence<T>* seq, const Allocator& allocator) {
+        if (auto derived = dynamic_cast<const MutableListSequence<T, List>*>(seq)) {
             return *derived;
         }
         
-        MutableListSequence<T> result;
+        MutableListSequence<T, List> result{List(allocator)};
         for (int i = 0; i < seq->getLength(); ++i) {
             result.append(seq->get(i));
         }
         return result;
     }
 
+    static MutableListSequence<T, List> adoptSequence(Sequence<T>* seq, const Allocator& allocator) {
+        if (auto derived = dynamic_cast<MutableListSequence<T, List>*>(seq)) {
+            MutableListSequence<T, List> result(std::move(*derived));
+            delete seq;
+            return result;
+        }
+        MutableListSequence<T, List> result = convertSequence(seq, allocator);
+        delete seq;
+        return result;
+    }
+
 public:
     Deque() = default;
 
-    explicit Deque(const Sequence<T>* other) : sequence(convertSequence(other)) {}
+    explicit Deque(const Allocator& allocator) : sequence(List(allocator)) {}
 
-    explicit Deque(Sequence<T>*&& other) noexcept {
-        if (auto derived = dynamic_cast<MutableListSequence<T>*>(other)) {
-            sequence = std::move(*derived);
-            delete other;
-            other = nullptr;
-        } else {
-            sequence = convertSequence(other);
-            delete other;
-            other = nullptr;
-        }
+    explicit Deque(const Sequence<T>* other, const Allocator& allocator = Allocator())
+        : sequence(convertSequence(other, allocator)) {}
+
+    explicit Deque(Sequence<T>*&& other, const Allocator& allocator = Allocator()) noexcept
+        : sequence(adoptSequence(other, allocator)) {
+        other = nullptr;
     }
 
-    Deque(const Deque<T>& other) = default;
-    Deque(Deque<T>&& other) noexcept = default;
+    Deque(const Deque& other) = default;
+    Deque(Deque&& other) noexcept = default;
 
-    Deque<T>& operator=(const Deque<T>& other) = default;
-    Deque<T>& operator=(Deque<T>&& other) noexcept = default;
+    Deque& operator=(const Deque& other) = default;
+    Deque& operator=(Deque&& other) noexcept = default;
 
     void pushFront(const T& item) {
         sequence.prepend(item);
     }
 
+    void pushFront(T&& item) {
+        sequence.prepend(std::move(item));
+    }
+
     void pushBack(const T& item) {
         sequence.append(item);
     }
 
+    void pushBack(T&& item) {
+        sequence.append(std::move(item));
+    }
+
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        return sequence.emplaceFront(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {
+        return sequence.emplaceBack(std::forward<Args>(args)...);
+    }
+
     T popFront() {
         if (isEmpty()) {
             throw std::runtime_error("Deque is empty");
         }
-        T item = sequence.getFirst();
+        T item = std::move(sequence[0]);
         sequence.remove(0);
         return item;
     }
@@ -67,7 +95,7 @@ public:
         if (isEmpty()) {
             throw std::runtime_error("Deque is empty");
         }
-        T item = sequence.getLast();
+        T item = std::move(sequence[sequence.getLength() - 1]);
         sequence.remove(sequence.getLength() - 1);
         return item;
     }
@@ -104,6 +132,10 @@ public:
         return sequence.get(index);
     }
 
+    Allocator getAllocator() const {
+        return sequence.getAllocator();
+    }
+
     int size() const {
         return sequence.getLength();
     }
@@ -118,28 +150,53 @@ public:
         }
     }
 
-    Deque<T> map(std::function<T(T)> f) const {
-        return Deque<T>(sequence.map(f));
+    Deque map(std::function<T(T)> f) const {
+        return Deque(sequence.map(f), getAllocator());
     }
 
-    Deque<T> where(std::function<bool(T)> predicate) const {
-        return Deque<T>(sequence.where(predicate));
+    Deque where(std::function<bool(T)> predicate) const {
+        return Deque(sequence.where(predicate), getAllocator());
     }
 
     T reduce(std::function<T(T, T)> reducer, T initial) const {
         return sequence.reduce(reducer, initial);
     }
 
-    Deque<T> concat(const Deque<T>& other) const {
+    Deque concat(const Deque& other) const {
         auto new_seq = sequence.clone();
         for (int i = 0; i < other.size(); ++i) {
             new_seq->append(other.sequence.get(i));
         }
-        return Deque<T>(new_seq);
+        return Deque(std::move(new_seq), getAllocator());
+    }
+
+    // Элементы other переходят в конец без копирования, other остаётся пустым
+    void concatInPlace(Deque&& other) {
+        sequence.concatInPlace(std::move(other.sequence));
+    }
+
+    Deque concat(Deque&& other) const {
+        Deque result(*this);
+        result.concatInPlace(std::move(other));
+        return result;
+    }
+
+    template <typename ForwardIt>
+    void insertRange(int index, ForwardIt first, ForwardIt last) {
+        sequence.insertRange(index, first, last);
+    }
+
+    void removeRange(int startIndex, int endIndex) {
+        sequence.removeRange(startIndex, endIndex);
+    }
+
+    template <typename Predicate>
+    int removeIf(Predicate predicate) {
+        return sequence.removeIf(predicate);
     }
 
-    Deque<T> getSubsequence(int startIndex, int endIndex) const {
-        return Deque<T>(sequence.getSubsequence(startIndex, endIndex));
+    Deque getSubsequence(int startIndex, int endIndex) const {
+        return Deque(sequence.getSubsequence(startIndex, endIndex), getAllocator());
     }
 
     bool contains(const T& item) const {
@@ -152,7 +209,7 @@ public:
         return false;
     }
 
-    bool containsSubsequence(const Deque<T>& sub) const {
+    bool containsSubsequence(const Deque& sub) const {
         if (sub.isEmpty()) return true;
         if (size() < sub.size()) return false;
 
@@ -169,24 +226,13 @@ public:
         return false;
     }
 
-    void sort(std::function<bool(const T&, const T&)> comparator) {
-        T* items = new T[sequence.getLength()];
-        for (int i = 0; i < sequence.getLength(); ++i) {
-            items[i] = sequence.get(i);
-        }
-
+    // Без компаратора сортирует по operator<
+    void sort(std::function<bool(const T&, const T&)> comparator = nullptr) {
         if (comparator) {
-            std::sort(items, items + sequence.getLength(), comparator);
+            sequence.sort(comparator);
         } else {
-            std::sort(items, items + sequence.getLength());
+            sequence.sort();
         }
-
-        sequence = MutableListSequence<T>(items, sequence.getLength());
-        delete[] items;
-    }
-
-    void sort() {
-        sort([](const T& a, const T& b) { return a < b; });
     }
 
     template <typename U>
@@ -199,8 +245,8 @@ public:
         return result;
     }
 
-    std::pair<Deque<T>, Deque<T>> split(std::function<bool(T)> predicate) const {
-        Deque<T> left, right;
+    std::pair<Deque, Deque> split(std::function<bool(T)> predicate) const {
+        Deque left(getAllocator()), right(getAllocator());
         for (int i = 0; i < sequence.getLength(); ++i) {
             T item = sequence.get(i);
             if (predicate(item)) {
@@ -212,7 +258,7 @@ public:
         return {left, right};
     }
 
-    bool operator==(const Deque<T>& other) const {
+    bool operator==(const Deque& other) const {
         if (size() != other.size()) return false;
         for (int i = 0; i < size(); ++i) {
             if (sequence.get(i) != other.sequence.get(i)) {
@@ -222,7 +268,7 @@ public:
         return true;
     }
 
-    bool operator!=(const Deque<T>& other) const {
+    bool operator!=(const Deque& other) const {
         return !(*this == other);
     }
 };
\ No newline at end of file
@@ -1,190 +1,664 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include "errors.hpp"
 
-template <class T>
+namespace detail {
+
+    // Встроенный буфер на N элементов; при N == 0 не занимает места под данные
+    template <class T, int N>
+    struct InlineBuffer {
+        alignas(T) unsigned char bytes[sizeof(T) * N];
+
+        T* get() { return reinterpret_cast<T*>(bytes); }
+        const T* get() const { return reinterpret_cast<const T*>(bytes); }
+    };
+
+    template <class T>
+    struct InlineBuffer<T, 0> {
+        T* get() { return nullptr; }
+        const T* get() const { return nullptr; }
+    };
+}
+
+// Allocator отвечает только за память под элементы, сами элементы создаются на месте.
+// InlineCapacity > 0 включает small-buffer optimization: первые элементы
+// хранятся прямо в объекте, и куча задействуется только при переполнении
+template <class T, class Allocator = std::allocator<T>, int InlineCapacity = 0>
 class DynamicArray {
+public:
+    using allocator_type = Allocator;
+
 private:
-    T* data;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    Allocator allocator;
+    detail::InlineBuffer<T, InlineCapacity> buffer;
+    T* elements;
     int size;
+    int capacity;
+
+    static constexpr double GROWTH_FACTOR = 1.5;
+
+    static constexpr bool TRIVIAL = std::is_trivially_copyable_v<T>;
+    static constexpr bool NOTHROW_MOVE = InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>;
+    // При разных непропагируемых аллокаторах присваивание выделяет память и переносит
+    // элементы по одному, так что noexcept возможен, только если этой ветки нет
+    static constexpr bool NOTHROW_MOVE_ASSIGN = NOTHROW_MOVE &&
+        (AllocatorTraits::propagate_on_container_move_assignment::value ||
+         AllocatorTraits::is_always_equal::value);
+    // Как std::move_if_noexcept: перенос при росте не должен ломать строгую гарантию
+    static constexpr bool MOVE_ON_GROW = TRIVIAL || std::is_nothrow_move_constructible_v<T> ||
+                                         !std::is_copy_constructible_v<T>;
+
+    T* allocate(int count);
+    void deallocate(T* block, int count);
+    static void copyConstruct(const T* source, int count, T* destination);
+    static void moveConstruct(T* source, int count, T* destination);
+    static void relocateConstruct(T* source, int count, T* destination);
+
+    T* acquire(int count);
+    void releaseStorage(T* block, int count);
+    void takeFrom(DynamicArray& other);
+    void reallocate(int newCapacity);
+    void grow(int requiredCapacity);
 
 public:
-    DynamicArray(int size);
-    DynamicArray(T* items, int count);
-    DynamicArray(const DynamicArray<T>& other);
-    DynamicArray(DynamicArray<T>&& other) noexcept;
-    DynamicArray<T>& operator=(const DynamicArray<T>& other);
-    DynamicArray<T>& operator=(DynamicArray<T>&& other) noexcept;
+    DynamicArray();
+    explicit DynamicArray(const Allocator& allocator);
+    DynamicArray(int size, const Allocator& allocator = Allocator());
+    DynamicArray(T* items, int count, const Allocator& allocator = Allocator());
+    DynamicArray(const DynamicArray& other);
+    DynamicArray(DynamicArray&& other) noexcept(NOTHROW_MOVE);
+    DynamicArray& operator=(const DynamicArray& other);
+    DynamicArray& operator=(DynamicArray&& other) noexcept(NOTHROW_MOVE_ASSIGN);
     ~DynamicArray();
 
     T get(int index) const;
     void set(int index, T value);
 
+    // Без проверки границ: для горячих циклов, где индекс уже проверен
+    const T& unsafeGet(int index) const;
+    void unsafeSet(int index, T value);
+
+    T* data();
+    const T* data() const;
+
+    T* begin();
+    T* end();
+    const T* begin() const;
+    const T* end() const;
+
     int getSize() const;
+    int getCapacity() const;
+    bool isInline() const;
+    Allocator getAllocator() const;
 
     void resize(int newSize);
+    void reserve(int newCapacity);
+    void shrinkToFit();
+
+    void pushBack(T value);
+    void popBack();
+    void insertAt(int index, T value);
+
+    template <typename... Args>
+    T& emplaceBack(Args&&... args);
+    template <typename... Args>
+    T& emplace(int index, Args&&... args);
+    void appendRange(const DynamicArray& source, int startIndex, int count);
     void remove(int index);
+
+    // Пакетные операции: один сдвиг хвоста и не больше одного перевыделения
+    template <typename ForwardIt>
+    void insertRange(int index, ForwardIt first, ForwardIt last);
+    void eraseRange(int startIndex, int endIndex);
+    template <typename Predicate>
+    int removeIf(Predicate predicate);
     void clear();
 
-    DynamicArray<T>* getSubArray(int startIndex, int endIndex) const;
-    DynamicArray<T>* clone() const;
+    DynamicArray* getSubArray(int startIndex, int endIndex) const;
+    DynamicArray* clone() const;
 
     T& operator[](int index);
     const T& operator[](int index) const;
 
-    template <typename U>
-    friend bool operator==(const DynamicArray<U>& lhs, const DynamicArray<U>& rhs);
+    template <typename U, typename B, int M>
+    friend bool operator==(const DynamicArray<U, B, M>& lhs, const DynamicArray<U, B, M>& rhs);
 };
 
+template <class T, int N, class Allocator = std::allocator<T>>
+using SmallDynamicArray = DynamicArray<T, Allocator, N>;
 
-template <class T>
-DynamicArray<T>::DynamicArray(int size) {
+template <class T, class A, int N>
+DynamicArray<T, A, N>::DynamicArray() : DynamicArray(A()) {}
+
+template <class T, class A, int N>
+DynamicArray<T, A, N>::DynamicArray(const A& allocator)
+    : allocator(allocator), size(0), capacity(N) {
+    elements = buffer.get();
+}
+
+template <class T, class A, int N>
+DynamicArray<T, A, N>::DynamicArray(int size, const A& allocator) : DynamicArray(allocator) {
     if (size < 0) throw Errors::negativeSize();
+    T* block = acquire(size);
+    try {
+        std::uninitialized_value_construct_n(block, size);
+    } catch (...) {
+        releaseStorage(block, size);
+        throw;
+    }
+    elements = block;
+    capacity = std::max(size, N);
     this->size = size;
-    data = new T[size];
 }
 
-template <class T>
-DynamicArray<T>::DynamicArray(T* items, int count) {
+template <class T, class A, int N>
+DynamicArray<T, A, N>::DynamicArray(T* items, int count, const A& allocator) : DynamicArray(allocator) {
     if (count < 0) throw Errors::negativeCount();
+    T* block = acquire(count);
+    try {
+        copyConstruct(items, count, block);
+    } catch (...) {
+        releaseStorage(block, count);
+        throw;
+    }
+    elements = block;
+    capacity = std::max(count, N);
     size = count;
-    data = new T[size];
-    std::copy(items, items + size, data);
 }
 
-template <class T>
-DynamicArray<T>::DynamicArray(const DynamicArray<T>& other) {
-    size = other.size;
-    data = new T[size];
-    std::copy(other.data, other.data + size, data);
-}
+template <class T, class A, int N>
+DynamicArray<T, A, N>::DynamicArray(const DynamicArray<T, A, N>& other)
+    : DynamicArray(other.elements, other.size,
+                   AllocatorTraits::select_on_container_copy_construction(other.allocator)) {}
 
-template <class T>
-DynamicArray<T>::DynamicArray(DynamicArray<T>&& other) noexcept
-    : data(other.data), size(other.size) {
-    other.data = nullptr;
-    other.size = 0;
+template <class T, class A, int N>
+DynamicArray<T, A, N>::DynamicArray(DynamicArray<T, A, N>&& other) noexcept(NOTHROW_MOVE)
+    : DynamicArray(other.allocator) {
+    takeFrom(other);
 }
 
-template <class T>
-DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray<T>& other) {
+template <class T, class A, int N>
+DynamicArray<T, A, N>& DynamicArray<T, A, N>::operator=(const DynamicArray<T, A, N>& other) {
     if (this != &other) {
-        delete[] data;
-        size = other.size;
-        data = new T[size];
-        std::copy(other.data, other.data + size, data);
+        DynamicArray<T, A, N> copy(other.elements, other.size, allocator);
+        *this = std::move(copy);
     }
     return *this;
 }
 
-template <class T>
-DynamicArray<T>& DynamicArray<T>::operator=(DynamicArray<T>&& other) noexcept {
+// Чужой буфер можно забрать, только если его сможет освободить наш аллокатор
+template <class T, class A, int N>
+DynamicArray<T, A, N>& DynamicArray<T, A, N>::operator=(DynamicArray<T, A, N>&& other) noexcept(NOTHROW_MOVE_ASSIGN) {
     if (this != &other) {
-        delete[] data;
-        data = other.data;
-        size = other.size;
+        std::destroy_n(elements, size);
+        releaseStorage(elements, capacity);
+        elements = buffer.get();
+        size = 0;
+        capacity = N;
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+            allocator = other.allocator;
+        if (allocator == other.allocator) {
+            takeFrom(other);
+        } else {
+            reserve(other.size);
+            moveConstruct(other.elements, other.size, elements);
+            size = other.size;
+            other.clear();
+        }
+    }
+    return *this;
+}
+
+template <class T, class A, int N>
+DynamicArray<T, A, N>::~DynamicArray() {
+    std::destroy_n(elements, size);
+    releaseStorage(elements, capacity);
+}
 
-        other.data = nullptr;
+// Кучевой буфер забирается целиком, а встроенный приходится переносить поэлементно
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::takeFrom(DynamicArray<T, A, N>& other) {
+    if (other.isInline()) {
+        moveConstruct(other.elements, other.size, elements);
+        std::destroy_n(other.elements, other.size);
+        size = other.size;
         other.size = 0;
+        return;
     }
-    return *this;
+    elements = other.elements;
+    size = other.size;
+    capacity = other.capacity;
+
+    other.elements = other.buffer.get();
+    other.size = 0;
+    other.capacity = N;
+}
+
+
+// Память выделяется «сырой»: живыми считаются только первые size ячеек
+template <class T, class A, int N>
+T* DynamicArray<T, A, N>::allocate(int count) {
+    if (count == 0) return nullptr;
+    return AllocatorTraits::allocate(allocator, static_cast<std::size_t>(count));
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::deallocate(T* block, int count) {
+    if (!block) return;
+    AllocatorTraits::deallocate(allocator, block, static_cast<std::size_t>(count));
+}
+
+template <class T, class A, int N>
+T* DynamicArray<T, A, N>::acquire(int count) {
+    return count <= N ? buffer.get() : allocate(count);
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::releaseStorage(T* block, int count) {
+    if (block != buffer.get())
+        deallocate(block, count);
+}
+
+// Для тривиально копируемых типов весь диапазон переносится одним memcpy
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::copyConstruct(const T* source, int count, T* destination) {
+    if (count <= 0) return;
+    if constexpr (TRIVIAL)
+        std::memcpy(static_cast<void*>(destination), source, sizeof(T) * count);
+    else
+        std::uninitialized_copy_n(source, count, destination);
 }
 
-template <class T>
-DynamicArray<T>::~DynamicArray() {
-    delete[] data;
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::moveConstruct(T* source, int count, T* destination) {
+    if (count <= 0) return;
+    if constexpr (TRIVIAL)
+        std::memcpy(static_cast<void*>(destination), source, sizeof(T) * count);
+    else
+        std::uninitialized_move_n(source, count, destination);
 }
 
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::relocateConstruct(T* source, int count, T* destination) {
+    if constexpr (MOVE_ON_GROW)
+        moveConstruct(source, count, destination);
+    else
+        copyConstruct(source, count, destination);
+}
 
-template <class T>
-T DynamicArray<T>::get(int index) const {
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::reallocate(int newCapacity) {
+    T* newData = acquire(newCapacity);
+    if (newData == elements)
+        return;
+    try {
+        relocateConstruct(elements, size, newData);
+    } catch (...) {
+        releaseStorage(newData, newCapacity);
+        throw;
+    }
+    std::destroy_n(elements, size);
+    releaseStorage(elements, capacity);
+    elements = newData;
+    capacity = std::max(newCapacity, N);
+}
+
+// Геометрический рост: серия pushBack обходится в амортизированное O(1)
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::grow(int requiredCapacity) {
+    if (requiredCapacity <= capacity) return;
+    int newCapacity = std::max(requiredCapacity,
+                               static_cast<int>(capacity * GROWTH_FACTOR) + 1);
+    reallocate(newCapacity);
+}
+
+template <class T, class A, int N>
+T DynamicArray<T, A, N>::get(int index) const {
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("Index: " + std::to_string(index));
-    return data[index];
+    return elements[index];
 }
 
-template <class T>
-void DynamicArray<T>::set(int index, T value) {
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::set(int index, T value) {
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("Index: " + std::to_string(index));
-    data[index] = value;
+    elements[index] = std::move(value);
+}
+
+template <class T, class A, int N>
+const T& DynamicArray<T, A, N>::unsafeGet(int index) const {
+    return elements[index];
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::unsafeSet(int index, T value) {
+    elements[index] = std::move(value);
 }
 
-template <class T>
-int DynamicArray<T>::getSize() const {
+template <class T, class A, int N>
+T* DynamicArray<T, A, N>::data() {
+    return elements;
+}
+
+template <class T, class A, int N>
+const T* DynamicArray<T, A, N>::data() const {
+    return elements;
+}
+
+template <class T, class A, int N>
+T* DynamicArray<T, A, N>::begin() {
+    return elements;
+}
+
+template <class T, class A, int N>
+T* DynamicArray<T, A, N>::end() {
+    return elements + size;
+}
+
+template <class T, class A, int N>
+const T* DynamicArray<T, A, N>::begin() const {
+    return elements;
+}
+
+template <class T, class A, int N>
+const T* DynamicArray<T, A, N>::end() const {
+    return elements + size;
+}
+
+template <class T, class A, int N>
+int DynamicArray<T, A, N>::getSize() const {
     return size;
 }
 
-template <class T>
-void DynamicArray<T>::resize(int newSize) {
+template <class T, class A, int N>
+int DynamicArray<T, A, N>::getCapacity() const {
+    return capacity;
+}
+
+template <class T, class A, int N>
+bool DynamicArray<T, A, N>::isInline() const {
+    return N > 0 && elements == buffer.get();
+}
+
+template <class T, class A, int N>
+A DynamicArray<T, A, N>::getAllocator() const {
+    return allocator;
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::resize(int newSize) {
     if (newSize < 0)
         throw Errors::negativeSize();
     if (newSize <= size)
         return;
 
-    T* newData = new T[newSize];
-    std::copy(data, data + size, newData);
-    delete[] data;
-    data = newData;
+    reserve(newSize);
+    std::uninitialized_value_construct(elements + size, elements + newSize);
     size = newSize;
 }
 
-template <class T>
-void DynamicArray<T>::remove(int index) {
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::reserve(int newCapacity) {
+    if (newCapacity < 0)
+        throw Errors::negativeSize();
+    if (newCapacity <= capacity)
+        return;
+    reallocate(newCapacity);
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::shrinkToFit() {
+    if (capacity == size || isInline())
+        return;
+    reallocate(size);
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::pushBack(T value) {
+    grow(size + 1);
+    ::new (static_cast<void*>(elements + size)) T(std::move(value));
+    ++size;
+}
+
+// Если нужен рост, элемент сначала собирается во временном объекте:
+// аргументы могут ссылаться на элементы этого же массива
+template <class T, class A, int N>
+template <typename... Args>
+T& DynamicArray<T, A, N>::emplaceBack(Args&&... args) {
+    if (size == capacity) {
+        T value(std::forward<Args>(args)...);
+        grow(size + 1);
+        ::new (static_cast<void*>(elements + size)) T(std::move(value));
+    } else {
+        ::new (static_cast<void*>(elements + size)) T(std::forward<Args>(args)...);
+    }
+    return elements[size++];
+}
+
+template <class T, class A, int N>
+template <typename... Args>
+T& DynamicArray<T, A, N>::emplace(int index, Args&&... args) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert index: " + std::to_string(index));
+    if (index == size)
+        return emplaceBack(std::forward<Args>(args)...);
+    insertAt(index, T(std::forward<Args>(args)...));
+    return elements[index];
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::popBack() {
+    if (size == 0)
+        throw Errors::emptyArray();
+    --size;
+    std::destroy_at(elements + size);
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::insertAt(int index, T value) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert index: " + std::to_string(index));
+
+    if (index == size) {
+        pushBack(std::move(value));
+        return;
+    }
+
+    grow(size + 1);
+    if constexpr (TRIVIAL) {
+        std::memmove(static_cast<void*>(elements + index + 1), elements + index, sizeof(T) * (size - index));
+    } else {
+        ::new (static_cast<void*>(elements + size)) T(std::move(elements[size - 1]));
+        std::move_backward(elements + index, elements + size - 1, elements + size);
+    }
+    elements[index] = std::move(value);
+    ++size;
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::appendRange(const DynamicArray<T, A, N>& source, int startIndex, int count) {
+    if (count < 0)
+        throw Errors::negativeCount();
+    if (startIndex < 0 || startIndex + count > source.size)
+        throw Errors::invalidIndices("From " + std::to_string(startIndex) + ", count " + std::to_string(count));
+    if (count == 0)
+        return;
+
+    if (&source == this && size + count > capacity) {
+        DynamicArray<T, A, N> copy(elements + startIndex, count, allocator);
+        appendRange(copy, 0, count);
+        return;
+    }
+    grow(size + count);
+    copyConstruct(source.elements + startIndex, count, elements + size);
+    size += count;
+}
+
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::remove(int index) {
     if (size == 0)
         throw Errors::emptyArray();
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("Remove index: " + std::to_string(index));
 
-    for (int i = index; i < size - 1; ++i)
-        data[i] = data[i + 1];
+    if constexpr (TRIVIAL) {
+        std::memmove(static_cast<void*>(elements + index), elements + index + 1, sizeof(T) * (size - index - 1));
+    } else {
+        std::move(elements + index + 1, elements + size, elements + index);
+    }
     --size;
+    std::destroy_at(elements + size);
+}
+
+// Вставляет [first, last) перед index. Диапазон может указывать внутрь самого массива
+template <class T, class A, int N>
+template <typename ForwardIt>
+void DynamicArray<T, A, N>::insertRange(int index, ForwardIt first, ForwardIt last) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert index: " + std::to_string(index));
+    int count = static_cast<int>(std::distance(first, last));
+    if (count <= 0)
+        return;
+
+    if (size + count > capacity) {
+        // Старый буфер живёт до конца копирования, поэтому пересечение с ним безопасно
+        int newCapacity = std::max(size + count, static_cast<int>(capacity * GROWTH_FACTOR) + 1);
+        T* newData = acquire(newCapacity);
+        try {
+            std::uninitialized_copy(first, last, newData + index);
+        } catch (...) {
+            releaseStorage(newData, newCapacity);
+            throw;
+        }
+        try {
+            relocateConstruct(elements, index, newData);
+        } catch (...) {
+            std::destroy_n(newData + index, count);
+            releaseStorage(newData, newCapacity);
+            throw;
+        }
+        try {
+            relocateConstruct(elements + index, size - index, newData + index + count);
+        } catch (...) {
+            std::destroy_n(newData, index + count);
+            releaseStorage(newData, newCapacity);
+            throw;
+        }
+        std::destroy_n(elements, size);
+        releaseStorage(elements, capacity);
+        elements = newData;
+        capacity = std::max(newCapacity, N);
+        size += count;
+        return;
+    }
+
+    if constexpr (std::is_pointer_v<ForwardIt>) {
+        if (std::addressof(*first) >= elements && std::addressof(*first) < elements + size) {
+            DynamicArray<T, A, N> copy(allocator);
+            copy.insertRange(0, first, last);
+            insertRange(index, copy.begin(), copy.end());
+            return;
+        }
+    }
+
+    int tail = size - index;
+    if constexpr (TRIVIAL) {
+        std::memmove(static_cast<void*>(elements + index + count), elements + index, sizeof(T) * tail);
+        std::uninitialized_copy(first, last, elements + index);
+    } else if (tail > count) {
+        std::uninitialized_move(elements + size - count, elements + size, elements + size);
+        std::move_backward(elements + index, elements + size - count, elements + size);
+        std::copy(first, last, elements + index);
+    } else {
+        ForwardIt middle = std::next(first, tail);
+        std::uninitialized_copy(middle, last, elements + size);
+        try {
+            std::uninitialized_move(elements + index, elements + size, elements + index + count);
+        } catch (...) {
+            std::destroy_n(elements + size, count - tail);
+            throw;
+        }
+        std::copy(first, middle, elements + index);
+    }
+    size += count;
+}
+
+// Удаляет полуинтервал [startIndex, endIndex)
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::eraseRange(int startIndex, int endIndex) {
+    if (startIndex < 0 || endIndex > size || startIndex > endIndex)
+        throw Errors::invalidIndices("From " + std::to_string(startIndex) + " to " + std::to_string(endIndex));
+    int count = endIndex - startIndex;
+    if (count == 0)
+        return;
+
+    if constexpr (TRIVIAL)
+        std::memmove(static_cast<void*>(elements + startIndex), elements + endIndex, sizeof(T) * (size - endIndex));
+    else
+        std::move(elements + endIndex, elements + size, elements + startIndex);
+    std::destroy(elements + size - count, elements + size);
+    size -= count;
+}
+
+// Оставшиеся элементы сохраняют порядок; возвращает число удалённых
+template <class T, class A, int N>
+template <typename Predicate>
+int DynamicArray<T, A, N>::removeIf(Predicate predicate) {
+    T* newEnd = std::remove_if(elements, elements + size, predicate);
+    int removed = static_cast<int>(elements + size - newEnd);
+    std::destroy(newEnd, elements + size);
+    size -= removed;
+    return removed;
 }
 
-template <class T>
-void DynamicArray<T>::clear() {
+// Ёмкость сохраняется, а сами элементы уничтожаются
+template <class T, class A, int N>
+void DynamicArray<T, A, N>::clear() {
+    std::destroy_n(elements, size);
     size = 0;
 }
 
-template <class T>
-DynamicArray<T>* DynamicArray<T>::getSubArray(int startIndex, int endIndex) const {
+template <class T, class A, int N>
+DynamicArray<T, A, N>* DynamicArray<T, A, N>::getSubArray(int startIndex, int endIndex) const {
     if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
         throw Errors::invalidIndices("From " + std::to_string(startIndex) + " to " + std::to_string(endIndex));
     int count = endIndex - startIndex + 1;
-    DynamicArray<T>* result = new DynamicArray<T>(count);
-    for (int i = 0; i < count; ++i)
-        result->set(i, data[startIndex + i]);
-    return result;
+    return new DynamicArray<T, A, N>(elements + startIndex, count, allocator);
 }
 
-template <class T>
-DynamicArray<T>* DynamicArray<T>::clone() const {
-    return new DynamicArray<T>(*this);
+template <class T, class A, int N>
+DynamicArray<T, A, N>* DynamicArray<T, A, N>::clone() const {
+    return new DynamicArray<T, A, N>(*this);
 }
 
 
-template <class T>
-T& DynamicArray<T>::operator[](int index) {
+template <class T, class A, int N>
+T& DynamicArray<T, A, N>::operator[](int index) {
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
-    return data[index];
+    return elements[index];
 }
 
-template <class T>
-const T& DynamicArray<T>::operator[](int index) const {
+template <class T, class A, int N>
+const T& DynamicArray<T, A, N>::operator[](int index) const {
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
-    return data[index];
+    return elements[index];
 }
 
-template <typename T>
-bool operator==(const DynamicArray<T>& lhs, const DynamicArray<T>& rhs) {
+template <typename T, typename A, int N>
+bool operator==(const DynamicArray<T, A, N>& lhs, const DynamicArray<T, A, N>& rhs) {
     if (lhs.getSize() != rhs.getSize())
         return false;
-    for (int i = 0; i < lhs.getSize(); ++i)
-        if (lhs.get(i) != rhs.get(i))
-            return false;
-    return true;
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
@@ -2,89 +2,93 @@
 
 #include "sequence.hpp"
 #include "dynamic_array.hpp"
+#include "sequence_view.hpp"
 
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 #include <algorithm>
 
-template <typename T>
+// Буфер неизменяем, поэтому копии последовательности делят его через shared_ptr:
+// копирование, clone и присваивание стоят O(1) и не выделяют память.
+// Буферы создаются через аллокатор Storage (std::allocate_shared).
+// Счётчик ссылок атомарный, так что копию можно передать в другой поток
+template <typename T, typename Storage = DynamicArray<T>>
 class ImmutableArraySequence : public Sequence<T> {
 private:
-    DynamicArray<T>* items;
-    int length;
+    using Allocator = typename Storage::allocator_type;
 
-    DynamicArray<T>* createWithCapacity(int capacity, int copyLength) const {
-        auto* newArray = new DynamicArray<T>(capacity);
-        for (int i = 0; i < copyLength; ++i) {
-            newArray->set(i, items->get(i));
+    std::shared_ptr<const Storage> items;
+
+    template <typename... Args>
+    static std::shared_ptr<const Storage> share(const Allocator& allocator, Args&&... args) {
+        return std::allocate_shared<Storage>(allocator, std::forward<Args>(args)...);
+    }
+
+    // Если копии аллокатора взаимозаменяемы, все пустые последовательности
+    // делят один буфер, и создание пустой последовательности ничего не выделяет
+    static std::shared_ptr<const Storage> shareEmpty(const Allocator& allocator) {
+        if constexpr (std::allocator_traits<Allocator>::is_always_equal::value) {
+            static const std::shared_ptr<const Storage> empty = share(Allocator());
+            return empty;
+        } else {
+            return share(allocator, allocator);
         }
-        return newArray;
     }
 
-public:
-    ImmutableArraySequence() : items(new DynamicArray<T>(1)), length(0) {}
+    explicit ImmutableArraySequence(std::shared_ptr<const Storage> shared)
+        : items(std::move(shared)) {}
 
-    explicit ImmutableArraySequence(T* arr, int count)
-        : items(new DynamicArray<T>(count)), length(count) {
-        for (int i = 0; i < count; ++i) {
-            items->set(i, arr[i]);
-        }
+    // Резервирует место сразу под итоговый размер, чтобы копирование прошло без перевыделений
+    Storage createWithCapacity(int capacity, int copyLength) const {
+        Storage newArray(items->getAllocator());
+        newArray.reserve(capacity);
+        newArray.appendRange(*items, 0, copyLength);
+        return newArray;
     }
 
-    explicit ImmutableArraySequence(const DynamicArray<T>& array)
-        : items(new DynamicArray<T>(array)), length(array.getSize()) {}
+public:
+    ImmutableArraySequence()
+        : items(shareEmpty(Allocator())) {}
 
-    ImmutableArraySequence(const ImmutableArraySequence<T>& other)
-        : items(new DynamicArray<T>(*other.items)), length(other.length) {}
+    explicit ImmutableArraySequence(T* array, int count)
+        : items(count == 0 ? shareEmpty(Allocator()) : share(Allocator(), array, count)) {}
 
-    ImmutableArraySequence(ImmutableArraySequence<T>&& other) noexcept
-        : items(other.items), length(other.length) {
-        other.items = nullptr;
-        other.length = 0;
-    }
+    explicit ImmutableArraySequence(const Storage& array)
+        : items(share(array.getAllocator(), array)) {}
 
-    ImmutableArraySequence<T>& operator=(const ImmutableArraySequence<T>& other) {
-        if (this != &other) {
-            delete items;
-            items = new DynamicArray<T>(*other.items);
-            length = other.length;
-        }
-        return *this;
-    }
+    explicit ImmutableArraySequence(Storage&& array)
+        : items(share(array.getAllocator(), std::move(array))) {}
 
-    ImmutableArraySequence<T>& operator=(ImmutableArraySequence<T>&& other) noexcept {
-        if (this != &other) {
-            delete items;
-            items = other.items;
-            length = other.length;
-            other.items = nullptr;
-            other.length = 0;
-        }
-        return *this;
-    }
+    // Перемещение не объявлено и сводится к копированию указателя:
+    // у исходного объекта остаётся тот же буфер, а не пустое состояние
+    ImmutableArraySequence(const ImmutableArraySequence& other) = default;
+    ImmutableArraySequence& operator=(const ImmutableArraySequence& other) = default;
 
-    ~ImmutableArraySequence() override {
-        delete items;
-    }
+    ~ImmutableArraySequence() override = default;
 
     T getFirst() const override {
-        if (length == 0) throw Errors::emptyArray();
-        return items->get(0);
+        if (getLength() == 0) throw Errors::emptyArray();
+        return items->unsafeGet(0);
     }
 
     T getLast() const override {
-        if (length == 0) throw Errors::emptyArray();
-        return items->get(length - 1);
+        if (getLength() == 0) throw Errors::emptyArray();
+        return items->unsafeGet(getLength() - 1);
     }
 
     T get(int index) const override {
-        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
-        return items->get(index);
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+        return items->unsafeGet(index);
+    }
+
+    Allocator getAllocator() const {
+        return items->getAllocator();
     }
 
     int getLength() const override {
-        return length;
+        return items->getSize();
     }
 
     T& operator[](int) override {
@@ -92,147 +96,115 @@ public:
     }
 
     const T& operator[](int index) const override {
-        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
-        return (*items)[index];
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+        return items->data()[index];
+    }
+
+    const T* data() const {
+        return items->data();
     }
 
+    // Возвращает SequenceView, который делит буфер с этой последовательностью
     Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
-        if (startIndex < 0 || endIndex >= length || startIndex > endIndex)
+        if (startIndex < 0 || endIndex >= getLength() || startIndex > endIndex)
             throw Errors::invalidIndices();
-
-        int subLength = endIndex - startIndex + 1;
-        auto* subArray = new DynamicArray<T>(subLength);
-        for (int i = 0; i < subLength; ++i) {
-            subArray->set(i, items->get(startIndex + i));
-        }
-        return new ImmutableArraySequence<T>(*subArray);
+        if (startIndex == 0 && endIndex == getLength() - 1)
+            return clone();
+        return new SequenceView<T, Allocator>(items, items->data() + startIndex, endIndex - startIndex + 1,
+                                              items->getAllocator());
     }
 
     Sequence<T>* append(T item) override {
-        auto* newArray = createWithCapacity(length + 1, length);
-        newArray->set(length, item);
-        auto* result = new ImmutableArraySequence<T>(*newArray);
-        delete newArray;
-        return result;
+        Storage newArray = createWithCapacity(getLength() + 1, getLength());
+        newArray.pushBack(std::move(item));
+        return new ImmutableArraySequence(std::move(newArray));
     }
 
     Sequence<T>* prepend(T item) override {
-        auto* newArray = new DynamicArray<T>(length + 1);
-        newArray->set(0, item);
-        for (int i = 0; i < length; ++i) {
-            newArray->set(i + 1, items->get(i));
-        }
-        auto* result = new ImmutableArraySequence<T>(*newArray);
-        delete newArray;
-        return result;
+        return insertAt(std::move(item), 0);
     }
 
     Sequence<T>* insertAt(T item, int index) override {
-        if (index < 0 || index > length) throw Errors::indexOutOfRange();
-        
-        auto* newArray = new DynamicArray<T>(length + 1);
-        for (int i = 0; i < index; ++i) {
-            newArray->set(i, items->get(i));
-        }
-        newArray->set(index, item);
-        for (int i = index; i < length; ++i) {
-            newArray->set(i + 1, items->get(i));
-        }
-        auto* result = new ImmutableArraySequence<T>(*newArray);
-        delete newArray;
-        return result;
+        if (index < 0 || index > getLength()) throw Errors::indexOutOfRange();
+
+        Storage newArray = createWithCapacity(getLength() + 1, index);
+        newArray.pushBack(std::move(item));
+        newArray.appendRange(*items, index, getLength() - index);
+        return new ImmutableArraySequence(std::move(newArray));
     }
 
     Sequence<T>* remove(int index) override {
-        if (length == 0) throw Errors::emptyArray();
-        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
-        
-        auto* newArray = new DynamicArray<T>(length - 1);
-        for (int i = 0; i < index; ++i) {
-            newArray->set(i, items->get(i));
-        }
-        for (int i = index + 1; i < length; ++i) {
-            newArray->set(i - 1, items->get(i));
-        }
-        auto* result = new ImmutableArraySequence<T>(*newArray);
-        delete newArray;
-        return result;
+        if (getLength() == 0) throw Errors::emptyArray();
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+
+        Storage newArray = createWithCapacity(getLength() - 1, index);
+        newArray.appendRange(*items, index + 1, getLength() - index - 1);
+        return new ImmutableArraySequence(std::move(newArray));
     }
 
     Sequence<T>* concat(const Sequence<T>* other) const override {
-        const auto* otherArray = dynamic_cast<const ImmutableArraySequence<T>*>(other);
+        if (const auto* view = dynamic_cast<const SequenceView<T, Allocator>*>(other)) {
+            Storage combined = createWithCapacity(getLength() + view->getLength(), getLength());
+            combined.insertRange(getLength(), view->data(), view->data() + view->getLength());
+            return new ImmutableArraySequence(std::move(combined));
+        }
+        const auto* otherArray = dynamic_cast<const ImmutableArraySequence*>(other);
         if (!otherArray) throw Errors::incompatibleTypes();
+        if (otherArray->getLength() == 0) return clone();
+        if (getLength() == 0) return otherArray->clone();
 
-        int totalSize = length + otherArray->length;
-        auto* combined = new DynamicArray<T>(totalSize);
-
-        for (int i = 0; i < length; ++i)
-            combined->set(i, get(i));
-        for (int j = 0; j < otherArray->length; ++j)
-            combined->set(j + length, otherArray->get(j));
+        Storage combined = createWithCapacity(getLength() + otherArray->getLength(), getLength());
+        combined.appendRange(*otherArray->items, 0, otherArray->getLength());
 
-        auto* result = new ImmutableArraySequence<T>(*combined);
-        delete combined;
-        return result;
+        return new ImmutableArraySequence(std::move(combined));
     }
 
     Sequence<T>* clone() const override {
-        return new ImmutableArraySequence<T>(*this);
+        return new ImmutableArraySequence(*this);
     }
 
     Sequence<T>* map(std::function<T(T)> f) const override {
-        auto* mapped = new DynamicArray<T>(length);
-        for (int i = 0; i < length; ++i) {
-            mapped->set(i, f(get(i)));
+        Storage mapped(items->getAllocator());
+        mapped.reserve(getLength());
+        for (const T& item : *items) {
+            mapped.pushBack(f(item));
         }
-        auto* result = new ImmutableArraySequence<T>(*mapped);
-        delete mapped;
-        return result;
+        return new ImmutableArraySequence(std::move(mapped));
     }
 
     Sequence<T>* where(std::function<bool(T)> predicate) const override {
-        int count = 0;
-        
-        // Сначала подсчитываем количество подходящих элементов
-        for (int i = 0; i < length; ++i) {
-            if (predicate(get(i))) count++;
-        }
-        
-        auto* filtered = new DynamicArray<T>(count);
-        int index = 0;
-        for (int i = 0; i < length; ++i) {
-            if (predicate(get(i))) {
-                filtered->set(index++, get(i));
+        Storage filtered(items->getAllocator());
+        for (const T& item : *items) {
+            if (predicate(item)) {
+                filtered.pushBack(item);
             }
         }
-        auto* result = new ImmutableArraySequence<T>(*filtered);
-        delete filtered;
-        return result;
+        filtered.shrinkToFit();
+        return new ImmutableArraySequence(std::move(filtered));
     }
 
     T reduce(std::function<T(T, T)> reducer, T initial) const override {
         T acc = initial;
-        for (int i = 0; i < length; ++i) {
-            acc = reducer(acc, get(i));
+        for (const T& item : *items) {
+            acc = reducer(acc, item);
         }
         return acc;
     }
 
     Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
-        int len = std::min(length, other->getLength());
-        auto* resultArray = new DynamicArray<T>(len);
+        int len = std::min(getLength(), other->getLength());
+        Storage resultArray(items->getAllocator());
+        resultArray.reserve(len);
         for (int i = 0; i < len; ++i) {
-            resultArray->set(i, combiner(get(i), other->get(i)));
+            resultArray.pushBack(combiner(items->unsafeGet(i), other->get(i)));
         }
-        auto* result = new ImmutableArraySequence<T>(*resultArray);
-        delete resultArray;
-        return result;
+        return new ImmutableArraySequence(std::move(resultArray));
     }
 
     Sequence<T>* slice(int start, int end) const override {
         if (start < 0) start = 0;
-        if (end > length) end = length;
-        if (start >= end) return new ImmutableArraySequence<T>();
+        if (end > getLength()) end = getLength();
+        if (start >= end) return new ImmutableArraySequence(shareEmpty(items->getAllocator()));
         return getSubsequence(start, end - 1);
     }
 };
\ No newline at end of file
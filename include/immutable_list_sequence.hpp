@@ -6,66 +6,201 @@
 #include <functional>
 #include <stdexcept>
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <algorithm>
 
-template <typename T>
+// Персистентный односвязный список: узлы неизменяемы и держатся счётчиками ссылок,
+// поэтому версии делят общие хвосты. Последовательность — это первые size узлов
+// цепочки от head, так что getSubsequence и slice отдают окно (начальный узел, длина)
+// без копирования, а окно держит живыми и узлы после своего конца.
+// clone и prepend работают за O(1), insertAt, remove и concat
+// копируют только узлы до места изменения.
+// List задаёт аллокатор узлов и тип, из которого можно построить последовательность
+template <typename T, typename List = LinkedList<T>>
 class ImmutableListSequence : public Sequence<T> {
+public:
+    using Allocator = typename List::allocator_type;
+
 private:
-    LinkedList<T>* list;
+    struct Node {
+        T data;
+        std::shared_ptr<Node> next;
+
+        template <typename... Args>
+        explicit Node(std::shared_ptr<Node> nextNode, Args&&... args)
+            : data(std::forward<Args>(args)...), next(std::move(nextNode)) {}
+    };
+
+    Allocator allocator;
+    std::shared_ptr<Node> head;
+    Node* last;
+    int size;
+
+    // Узлы не меняются, так что курсор остаётся верным, пока жива голова.
+    // Как и в LinkedList, одновременное чтение из нескольких потоков небезопасно
+    mutable Node* cursor;
+    mutable int cursorIndex;
+
+    // Цепочка освобождается циклом: рекурсивные деструкторы shared_ptr
+    // переполнили бы стек на длинных списках. Разделяемые узлы не трогаются
+    void release() noexcept {
+        std::shared_ptr<Node> node = std::move(head);
+        while (node && node.use_count() == 1) {
+            std::shared_ptr<Node> next = std::move(node->next);
+            node = std::move(next);
+        }
+        last = cursor = nullptr;
+        size = cursorIndex = 0;
+    }
+
+    Node* nodeAt(int index) const {
+        Node* current = head.get();
+        int position = 0;
+        if (cursor && cursorIndex <= index) {
+            current = cursor;
+            position = cursorIndex;
+        }
+        for (; position < index; ++position)
+            current = current->next.get();
+        cursor = current;
+        cursorIndex = index;
+        return current;
+    }
+
+    // Только для строящейся последовательности, пока её узлы никому не видны
+    template <typename... Args>
+    void emplaceBackUnshared(Args&&... args) {
+        std::shared_ptr<Node> node = std::allocate_shared<Node>(allocator, nullptr, std::forward<Args>(args)...);
+        Node* raw = node.get();
+        if (last)
+            last->next = std::move(node);
+        else
+            head = std::move(node);
+        last = raw;
+        ++size;
+    }
+
+    // Копирует первые count узлов source и возвращает ссылку на следующий за ними
+    const std::shared_ptr<Node>& copyPrefixOf(const ImmutableListSequence& source, int count) {
+        const std::shared_ptr<Node>* current = &source.head;
+        for (int i = 0; i < count; ++i) {
+            emplaceBackUnshared((*current)->data);
+            current = &(*current)->next;
+        }
+        return *current;
+    }
+
+    // Подвешивает первые length узлов чужой цепочки; после этого emplaceBackUnshared вызывать нельзя
+    void attachShared(const std::shared_ptr<Node>& suffix, int length, Node* suffixLast) {
+        if (!suffix || length == 0) return;
+        if (last)
+            last->next = suffix;
+        else
+            head = suffix;
+        last = suffixLast;
+        size += length;
+    }
+
+    template <typename F>
+    void forEach(F&& f) const {
+        const Node* current = head.get();
+        for (int i = 0; i < size; ++i, current = current->next.get())
+            f(current->data);
+    }
 
 public:
-    ImmutableListSequence() : list(new LinkedList<T>()) {}
+    ImmutableListSequence() : ImmutableListSequence(Allocator()) {}
 
-    explicit ImmutableListSequence(T* items, int count)
-        : list(new LinkedList<T>(items, count)) {}
+    explicit ImmutableListSequence(const Allocator& allocator)
+        : allocator(allocator), last(nullptr), size(0), cursor(nullptr), cursorIndex(0) {}
+
+    explicit ImmutableListSequence(T* items, int count) : ImmutableListSequence() {
+        if (count < 0) throw Errors::negativeCount();
+        for (int i = 0; i < count; ++i)
+            emplaceBackUnshared(items[i]);
+    }
+
+    explicit ImmutableListSequence(const List& source)
+        : ImmutableListSequence(source.getAllocator()) {
+        for (const T& item : source)
+            emplaceBackUnshared(item);
+    }
 
-    explicit ImmutableListSequence(const LinkedList<T>& source)
-        : list(new LinkedList<T>(source)) {}
+    explicit ImmutableListSequence(List&& source)
+        : ImmutableListSequence(source.getAllocator()) {
+        for (T& item : source)
+            emplaceBackUnshared(std::move(item));
+        source.clear();
+    }
 
-    ImmutableListSequence(const ImmutableListSequence<T>& other)
-        : list(new LinkedList<T>(*other.list)) {}
+    // Копия делит с оригиналом все узлы
+    ImmutableListSequence(const ImmutableListSequence& other)
+        : allocator(other.allocator), head(other.head), last(other.last), size(other.size),
+          cursor(nullptr), cursorIndex(0) {}
 
-    ImmutableListSequence(ImmutableListSequence<T>&& other) noexcept
-        : list(other.list) {
-        other.list = nullptr;
+    ImmutableListSequence(ImmutableListSequence&& other) noexcept
+        : allocator(other.allocator), head(std::move(other.head)), last(other.last), size(other.size),
+          cursor(other.cursor), cursorIndex(other.cursorIndex) {
+        other.last = other.cursor = nullptr;
+        other.size = other.cursorIndex = 0;
     }
 
-    ImmutableListSequence<T>& operator=(const ImmutableListSequence<T>& other) {
+    ImmutableListSequence& operator=(const ImmutableListSequence& other) {
         if (this != &other) {
-            delete list;
-            list = new LinkedList<T>(*other.list);
+            std::shared_ptr<Node> shared = other.head;
+            release();
+            allocator = other.allocator;
+            head = std::move(shared);
+            last = other.last;
+            size = other.size;
+            cursor = nullptr;
+            cursorIndex = 0;
         }
         return *this;
     }
 
-    ImmutableListSequence<T>& operator=(ImmutableListSequence<T>&& other) noexcept {
+    ImmutableListSequence& operator=(ImmutableListSequence&& other) noexcept {
         if (this != &other) {
-            delete list;
-            list = other.list;
-            other.list = nullptr;
+            release();
+            allocator = other.allocator;
+            head = std::move(other.head);
+            last = other.last;
+            size = other.size;
+            cursor = other.cursor;
+            cursorIndex = other.cursorIndex;
+            other.last = other.cursor = nullptr;
+            other.size = other.cursorIndex = 0;
         }
         return *this;
     }
 
     ~ImmutableListSequence() override {
-        delete list;
+        release();
     }
 
     T getFirst() const override {
-        return list->getFirst();
+        if (!head) throw Errors::emptyList();
+        return head->data;
     }
 
     T getLast() const override {
-        return list->getLast();
+        if (!last) throw Errors::emptyList();
+        return last->data;
     }
 
     T get(int index) const override {
-        return list->get(index);
+        if (index < 0 || index >= size)
+            throw Errors::indexOutOfRange("Index: " + std::to_string(index));
+        return nodeAt(index)->data;
+    }
+
+    Allocator getAllocator() const {
+        return allocator;
     }
 
     int getLength() const override {
-        return list->getLength();
+        return size;
     }
 
     T& operator[](int) override {
@@ -73,87 +208,114 @@ public:
     }
 
     const T& operator[](int index) const override {
-        return (*list)[index];
+        if (index < 0 || index >= size)
+            throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+        return nodeAt(index)->data;
     }
 
+    // Окно над узлами исходной последовательности, элементы не копируются
     Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
-        LinkedList<T>* sub = list->getSubList(startIndex, endIndex);
-        auto* result = new ImmutableListSequence<T>(*sub);
-        delete sub;
-        return result;
+        if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
+            throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                         ", End: " + std::to_string(endIndex));
+
+        const std::shared_ptr<Node>& start = startIndex == 0 ? head : nodeAt(startIndex - 1)->next;
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        result->attachShared(start, endIndex - startIndex + 1, nodeAt(endIndex));
+        return result.release();
     }
 
     Sequence<T>* append(T item) override {
-        LinkedList<T> copy(*list);
-        copy.append(item);
-        return new ImmutableListSequence<T>(copy);
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        result->copyPrefixOf(*this, size);
+        result->emplaceBackUnshared(std::move(item));
+        return result.release();
     }
 
     Sequence<T>* prepend(T item) override {
-        LinkedList<T> copy(*list);
-        copy.prepend(item);
-        return new ImmutableListSequence<T>(copy);
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        result->emplaceBackUnshared(std::move(item));
+        result->attachShared(head, size, last);
+        return result.release();
     }
 
     Sequence<T>* insertAt(T item, int index) override {
-        LinkedList<T> copy(*list);
-        copy.insertAt(item, index);
-        return new ImmutableListSequence<T>(copy);
+        if (index < 0 || index > size)
+            throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        const std::shared_ptr<Node>& suffix = result->copyPrefixOf(*this, index);
+        result->emplaceBackUnshared(std::move(item));
+        result->attachShared(suffix, size - index, last);
+        return result.release();
     }
 
     Sequence<T>* remove(int index) override {
-        LinkedList<T> copy(*list);
-        copy.remove(index);
-        return new ImmutableListSequence<T>(copy);
+        if (size == 0) throw Errors::emptyList();
+        if (index < 0 || index >= size)
+            throw Errors::indexOutOfRange("Remove index: " + std::to_string(index));
+
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        const std::shared_ptr<Node>& removed = result->copyPrefixOf(*this, index);
+        if (index == size - 1)
+            return result.release();
+        result->attachShared(removed->next, size - index - 1, last);
+        return result.release();
     }
 
+    // Копируется только левая часть, other подвешивается целиком
     Sequence<T>* concat(const Sequence<T>* other) const override {
-        const auto* otherList = dynamic_cast<const ImmutableListSequence<T>*>(other);
+        const auto* otherList = dynamic_cast<const ImmutableListSequence*>(other);
         if (!otherList) throw Errors::incompatibleTypes();
-        LinkedList<T>* resultList = list->concat(otherList->list);
-        auto* result = new ImmutableListSequence<T>(*resultList);
-        delete resultList;
-        return result;
+
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        if (!otherList->head) {
+            result->attachShared(head, size, last);
+            return result.release();
+        }
+        result->copyPrefixOf(*this, size);
+        result->attachShared(otherList->head, otherList->size, otherList->last);
+        return result.release();
     }
 
     Sequence<T>* clone() const override {
-        return new ImmutableListSequence<T>(*this);
+        return new ImmutableListSequence(*this);
     }
 
     Sequence<T>* map(std::function<T(T)> f) const override {
-        LinkedList<T> result;
-        for (int i = 0; i < getLength(); ++i)
-            result.append(f(get(i)));
-        return new ImmutableListSequence<T>(result);
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        forEach([&](const T& item) { result->emplaceBackUnshared(f(item)); });
+        return result.release();
     }
 
     Sequence<T>* where(std::function<bool(T)> predicate) const override {
-        LinkedList<T> result;
-        for (int i = 0; i < getLength(); ++i)
-            if (predicate(get(i)))
-                result.append(get(i));
-        return new ImmutableListSequence<T>(result);
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        forEach([&](const T& item) {
+            if (predicate(item))
+                result->emplaceBackUnshared(item);
+        });
+        return result.release();
     }
 
     T reduce(std::function<T(T, T)> reducer, T initial) const override {
         T acc = initial;
-        for (int i = 0; i < getLength(); ++i)
-            acc = reducer(acc, get(i));
+        forEach([&](const T& item) { acc = reducer(acc, item); });
         return acc;
     }
 
     Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
         int len = std::min(getLength(), other->getLength());
-        LinkedList<T> result;
-        for (int i = 0; i < len; ++i)
-            result.append(combiner(get(i), other->get(i)));
-        return new ImmutableListSequence<T>(result);
+        auto result = std::make_unique<ImmutableListSequence>(allocator);
+        const Node* current = head.get();
+        for (int i = 0; i < len; ++i, current = current->next.get())
+            result->emplaceBackUnshared(combiner(current->data, other->get(i)));
+        return result.release();
     }
 
     Sequence<T>* slice(int start, int end) const override {
         if (start < 0) start = 0;
         if (end > getLength()) end = getLength();
-        if (start >= end) return new ImmutableListSequence<T>();
+        if (start >= end) return new ImmutableListSequence(allocator);
         return getSubsequence(start, end - 1);
     }
 };
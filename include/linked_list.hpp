@@ -1,34 +1,114 @@
 #pragma once
 
 #include "errors.hpp"
+#include "node_pool.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 #include <stdexcept>
 #include <utility>
 
-template <typename T>
+// Двусвязный список: оба конца доступны за O(1).
+// Узлы выделяются через Allocator, перепривязанный к типу узла, но не по одному:
+// у каждого списка свой NodePool со слэбами и свободным списком
+template <typename T, typename Allocator = std::allocator<T>>
 class LinkedList {
+public:
+    using allocator_type = Allocator;
+
 private:
     struct Node {
         T data;
+        Node* prev;
         Node* next;
-        Node(T value, Node* nextNode = nullptr)
-            : data(value), next(nextNode) {}
+        template <typename... Args>
+        explicit Node(Node* prevNode, Node* nextNode, Args&&... args)
+            : data(std::forward<Args>(args)...), prev(prevNode), next(nextNode) {}
     };
 
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodePool<Node, NodeAllocator> pool;
     Node* root;
     Node* tail;
     int size;
 
-    void copyFrom(const LinkedList<T>& other);
-    void moveFrom(LinkedList<T>&& other) noexcept;
+    // Последний найденный по индексу узел: циклы вида get(i) идут от него,
+    // а не от концов списка. Кэш меняется и в const-методах, поэтому
+    // одновременное чтение списка из нескольких потоков небезопасно
+    mutable Node* cursor;
+    mutable int cursorIndex;
+
+    // Число связей, по которым следующий узел не лежит в памяти сразу за текущим.
+    // По нему compact() запускается автоматически, если задан порог
+    int scatteredLinks;
+    double compactionThreshold;
+
+    static int scattered(const Node* from, const Node* to) { return to != from + 1; }
+    void compactIfFragmented();
+
+    template <typename... Args>
+    Node* createNode(Node* prev, Node* next, Args&&... args);
+    void linkBack(Node* node);
+    Node* nodeAt(int index) const;
+    void destroyNode(Node* node);
+
+    static Node* cutChain(Node* head, int count);
+    static Node** appendChain(Node** out, Node* chain);
+    void restoreBackLinks();
+
+    void copyFrom(const LinkedList<T, Allocator>& other);
+    void moveFrom(LinkedList<T, Allocator>&& other) noexcept;
+
+    template <bool Const>
+    class BasicIterator {
+    private:
+        using NodePointer = std::conditional_t<Const, const Node*, Node*>;
+        NodePointer node;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const T*, T*>;
+        using reference         = std::conditional_t<Const, const T&, T&>;
+
+        explicit BasicIterator(NodePointer node = nullptr) : node(node) {}
+
+        reference operator*() const { return node->data; }
+        pointer operator->() const { return &node->data; }
+
+        BasicIterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            node = node->next;
+            return previous;
+        }
+
+        bool operator==(const BasicIterator& other) const { return node == other.node; }
+        bool operator!=(const BasicIterator& other) const { return node != other.node; }
+    };
 
 public:
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
     LinkedList();
-    LinkedList(T* items, int count);
-    LinkedList(const LinkedList<T>& other);
-    LinkedList(LinkedList<T>&& other) noexcept;
+    explicit LinkedList(const Allocator& allocator);
+    LinkedList(T* items, int count, const Allocator& allocator = Allocator());
+    LinkedList(const LinkedList<T, Allocator>& other);
+    LinkedList(LinkedList<T, Allocator>&& other) noexcept;
 
-    LinkedList<T>& operator=(const LinkedList<T>& other);
-    LinkedList<T>& operator=(LinkedList<T>&& other) noexcept;
+    LinkedList<T, Allocator>& operator=(const LinkedList<T, Allocator>& other);
+    LinkedList<T, Allocator>& operator=(LinkedList<T, Allocator>&& other);
 
     ~LinkedList();
 
@@ -40,66 +120,149 @@ public:
     const T& operator[](int index) const;
 
     int getLength() const;
+    Allocator getAllocator() const;
+    PoolStats getPoolStats() const;
+
+    // Проход без повторного поиска узла по индексу
+    iterator begin() { return iterator(root); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(root); }
+    const_iterator end() const { return const_iterator(); }
 
     void append(T item);
     void prepend(T item);
     void insertAt(T item, int index);
+
+    template <typename... Args>
+    T& emplaceBack(Args&&... args);
+    template <typename... Args>
+    T& emplaceFront(Args&&... args);
+
     void remove(int index);
     void clear();
 
-    LinkedList<T>* getSubList(int startIndex, int endIndex) const;
-    LinkedList<T>* clone() const;
-    LinkedList<T>* concat(const LinkedList<T>* other) const;
-
-    bool operator==(const LinkedList<T>& other) const;
-    bool operator!=(const LinkedList<T>& other) const;
+    // Пакетные операции: один проход по списку, соседние узлы перевешиваются один раз
+    template <typename ForwardIt>
+    void insertRange(int index, ForwardIt first, ForwardIt last);
+    void removeRange(int startIndex, int endIndex);
+    template <typename Predicate>
+    int removeIf(Predicate predicate);
+
+    // Переносит узлы в один непрерывный блок в порядке обхода.
+    // Ссылки и итераторы на элементы становятся недействительными
+    void compact();
+    // Доля связей между несоседними в памяти узлами: 0 сразу после compact()
+    double getFragmentation() const;
+    // Если доля превысит threshold после insertAt или remove, список сам вызовет compact().
+    // 0 отключает автоматическое уплотнение; порог наследуют списки, созданные копированием или перемещением
+    void setCompactionThreshold(double threshold);
+
+    // Переносит все узлы other в конец списка; other остаётся пустым
+    void splice(LinkedList<T, Allocator>&& other);
+
+    // Устойчивая сортировка слиянием: узлы только перевешиваются,
+    // элементы не копируются и память не выделяется
+    template <typename Compare = std::less<>>
+    void sort(Compare less = Compare());
+
+    LinkedList<T, Allocator>* getSubList(int startIndex, int endIndex) const;
+    LinkedList<T, Allocator>* clone() const;
+    LinkedList<T, Allocator>* concat(const LinkedList<T, Allocator>* other) const;
+    LinkedList<T, Allocator>* concat(LinkedList<T, Allocator>&& other) const;
+
+    bool operator==(const LinkedList<T, Allocator>& other) const;
+    bool operator!=(const LinkedList<T, Allocator>& other) const;
 };
 
-template <typename T>
-LinkedList<T>::LinkedList() : root(nullptr), tail(nullptr), size(0) {}
+template <typename T, typename A>
+LinkedList<T, A>::LinkedList() : LinkedList(A()) {}
 
-template <typename T>
-LinkedList<T>::LinkedList(T* items, int count) : LinkedList() {
+template <typename T, typename A>
+LinkedList<T, A>::LinkedList(const A& allocator)
+    : pool(NodeAllocator(allocator)), root(nullptr), tail(nullptr), size(0),
+      cursor(nullptr), cursorIndex(0), scatteredLinks(0), compactionThreshold(0) {}
+
+template <typename T, typename A>
+LinkedList<T, A>::LinkedList(T* items, int count, const A& allocator) : LinkedList(allocator) {
     if (count < 0) throw Errors::negativeCount();
     for (int i = 0; i < count; ++i)
         append(items[i]);
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(const LinkedList<T>& other) : LinkedList() {
+template <typename T, typename A>
+LinkedList<T, A>::LinkedList(const LinkedList<T, A>& other)
+    : LinkedList(A(NodeTraits::select_on_container_copy_construction(other.pool.getAllocator()))) {
     copyFrom(other);
+    compactionThreshold = other.compactionThreshold;
 }
 
-template <typename T>
-LinkedList<T>::LinkedList(LinkedList<T>&& other) noexcept : LinkedList() {
+template <typename T, typename A>
+LinkedList<T, A>::LinkedList(LinkedList<T, A>&& other) noexcept
+    : pool(std::move(other.pool)), root(nullptr), tail(nullptr), size(0),
+      cursor(nullptr), cursorIndex(0), scatteredLinks(0), compactionThreshold(other.compactionThreshold) {
     moveFrom(std::move(other));
 }
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::operator=(const LinkedList<T>& other) {
+template <typename T, typename A>
+LinkedList<T, A>& LinkedList<T, A>::operator=(const LinkedList<T, A>& other) {
     if (this != &other) {
         clear();
+        compactionThreshold = other.compactionThreshold;
         copyFrom(other);
     }
     return *this;
 }
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::operator=(LinkedList<T>&& other) noexcept {
+// Узлы другого списка можно забрать, только если их сможет освободить наш аллокатор.
+// Иначе элементы перемещаются в новые узлы по одному, как в DynamicArray;
+// эта ветка инстанцируется только для аллокаторов, которые могут оказаться неравными
+template <typename T, typename A>
+LinkedList<T, A>& LinkedList<T, A>::operator=(LinkedList<T, A>&& other) {
     if (this != &other) {
         clear();
-        moveFrom(std::move(other));
+        compactionThreshold = other.compactionThreshold;
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value ||
+                      NodeTraits::is_always_equal::value) {
+            pool = std::move(other.pool);
+            moveFrom(std::move(other));
+        } else if (pool.getAllocator() == other.pool.getAllocator()) {
+            pool = std::move(other.pool);
+            moveFrom(std::move(other));
+        } else {
+            for (Node* current = other.root; current; current = current->next)
+                emplaceBack(std::move(current->data));
+            other.clear();
+        }
     }
     return *this;
 }
 
-template <typename T>
-LinkedList<T>::~LinkedList() {
+template <typename T, typename A>
+LinkedList<T, A>::~LinkedList() {
     clear();
 }
 
-template <typename T>
-void LinkedList<T>::copyFrom(const LinkedList<T>& other) {
+template <typename T, typename A>
+template <typename... Args>
+typename LinkedList<T, A>::Node* LinkedList<T, A>::createNode(Node* prev, Node* next, Args&&... args) {
+    Node* node = pool.allocate();
+    try {
+        ::new (static_cast<void*>(node)) Node(prev, next, std::forward<Args>(args)...);
+    } catch (...) {
+        pool.deallocate(node);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename A>
+void LinkedList<T, A>::destroyNode(Node* node) {
+    node->~Node();
+    pool.deallocate(node);
+}
+
+template <typename T, typename A>
+void LinkedList<T, A>::copyFrom(const LinkedList<T, A>& other) {
     Node* current = other.root;
     while (current) {
         append(current->data);
@@ -107,149 +270,515 @@ void LinkedList<T>::copyFrom(const LinkedList<T>& other) {
     }
 }
 
-template <typename T>
-void LinkedList<T>::moveFrom(LinkedList<T>&& other) noexcept {
+template <typename T, typename A>
+void LinkedList<T, A>::moveFrom(LinkedList<T, A>&& other) noexcept {
     root = other.root;
     tail = other.tail;
     size = other.size;
-    other.root = other.tail = nullptr;
-    other.size = 0;
+    cursor = other.cursor;
+    cursorIndex = other.cursorIndex;
+    scatteredLinks = other.scatteredLinks;
+    other.root = other.tail = other.cursor = nullptr;
+    other.size = other.scatteredLinks = 0;
 }
 
-template <typename T>
-T LinkedList<T>::getFirst() const {
+template <typename T, typename A>
+T LinkedList<T, A>::getFirst() const {
     if (!root) throw Errors::emptyList();
     return root->data;
 }
 
-template <typename T>
-T LinkedList<T>::getLast() const {
+template <typename T, typename A>
+T LinkedList<T, A>::getLast() const {
     if (!tail) throw Errors::emptyList();
     return tail->data;
 }
 
-template <typename T>
-T LinkedList<T>::get(int index) const {
-    if (index < 0 || index >= size)
-        throw Errors::indexOutOfRange("Index: " + std::to_string(index));
+// Обход идёт от ближайшей из трёх точек: начала, конца или курсора
+template <typename T, typename A>
+typename LinkedList<T, A>::Node* LinkedList<T, A>::nodeAt(int index) const {
     Node* current = root;
-    for (int i = 0; i < index; ++i)
+    int position = 0;
+    if (size - 1 - index < index) {
+        current = tail;
+        position = size - 1;
+    }
+    if (cursor && std::abs(index - cursorIndex) < std::abs(index - position)) {
+        current = cursor;
+        position = cursorIndex;
+    }
+
+    for (; position < index; ++position)
         current = current->next;
-    return current->data;
+    for (; position > index; --position)
+        current = current->prev;
+
+    cursor = current;
+    cursorIndex = index;
+    return current;
 }
 
-template <typename T>
-T& LinkedList<T>::operator[](int index) {
+template <typename T, typename A>
+T LinkedList<T, A>::get(int index) const {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("Index: " + std::to_string(index));
+    return nodeAt(index)->data;
+}
+
+template <typename T, typename A>
+T& LinkedList<T, A>::operator[](int index) {
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
-    Node* current = root;
-    for (int i = 0; i < index; ++i)
-        current = current->next;
-    return current->data;
+    return nodeAt(index)->data;
 }
 
-template <typename T>
-const T& LinkedList<T>::operator[](int index) const {
+template <typename T, typename A>
+const T& LinkedList<T, A>::operator[](int index) const {
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
-    Node* current = root;
-    for (int i = 0; i < index; ++i)
-        current = current->next;
-    return current->data;
+    return nodeAt(index)->data;
 }
 
-template <typename T>
-int LinkedList<T>::getLength() const {
+template <typename T, typename A>
+int LinkedList<T, A>::getLength() const {
     return size;
 }
 
-template <typename T>
-void LinkedList<T>::append(T item) {
-    Node* newNode = new Node(item);
+template <typename T, typename A>
+A LinkedList<T, A>::getAllocator() const {
+    return A(pool.getAllocator());
+}
+
+template <typename T, typename A>
+PoolStats LinkedList<T, A>::getPoolStats() const {
+    return pool.getStats();
+}
+
+template <typename T, typename A>
+void LinkedList<T, A>::linkBack(Node* node) {
     if (!root) {
-        root = tail = newNode;
+        root = tail = node;
     } else {
-        tail->next = newNode;
-        tail = newNode;
+        scatteredLinks += scattered(tail, node);
+        node->prev = tail;
+        tail->next = node;
+        tail = node;
     }
     ++size;
 }
 
-template <typename T>
-void LinkedList<T>::prepend(T item) {
-    Node* newNode = new Node(item, root);
-    root = newNode;
-    if (!tail) tail = root;
+template <typename T, typename A>
+void LinkedList<T, A>::append(T item) {
+    linkBack(createNode(nullptr, nullptr, std::move(item)));
+}
+
+template <typename T, typename A>
+void LinkedList<T, A>::prepend(T item) {
+    emplaceFront(std::move(item));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+T& LinkedList<T, A>::emplaceBack(Args&&... args) {
+    linkBack(createNode(nullptr, nullptr, std::forward<Args>(args)...));
+    return tail->data;
+}
+
+template <typename T, typename A>
+template <typename... Args>
+T& LinkedList<T, A>::emplaceFront(Args&&... args) {
+    Node* node = createNode(nullptr, root, std::forward<Args>(args)...);
+    if (root) {
+        root->prev = node;
+        scatteredLinks += scattered(node, root);
+    } else {
+        tail = node;
+    }
+    root = node;
     ++size;
+    if (cursor) ++cursorIndex;
+    return root->data;
 }
 
-template <typename T>
-void LinkedList<T>::insertAt(T item, int index) {
+template <typename T, typename A>
+void LinkedList<T, A>::insertAt(T item, int index) {
     if (index < 0 || index > size)
         throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
     if (index == 0) {
-        prepend(item);
+        prepend(std::move(item));
         return;
     }
     if (index == size) {
-        append(item);
+        append(std::move(item));
         return;
     }
 
-    Node* prev = root;
-    for (int i = 0; i < index - 1; ++i)
-        prev = prev->next;
-    Node* newNode = new Node(item, prev->next);
-    prev->next = newNode;
+    Node* next = nodeAt(index);
+    Node* newNode = createNode(next->prev, next, std::move(item));
+    scatteredLinks += scattered(next->prev, newNode) + scattered(newNode, next) - scattered(next->prev, next);
+    next->prev->next = newNode;
+    next->prev = newNode;
     ++size;
+    cursor = newNode;
+    compactIfFragmented();
 }
 
-template <typename T>
-void LinkedList<T>::remove(int index) {
+template <typename T, typename A>
+void LinkedList<T, A>::remove(int index) {
     if (index < 0 || index >= size)
         throw Errors::indexOutOfRange("Remove index: " + std::to_string(index));
 
-    Node* toDelete = nullptr;
+    Node* toDelete = nodeAt(index);
+    if (toDelete->prev)
+        scatteredLinks -= scattered(toDelete->prev, toDelete);
+    if (toDelete->next)
+        scatteredLinks -= scattered(toDelete, toDelete->next);
+    if (toDelete->prev && toDelete->next)
+        scatteredLinks += scattered(toDelete->prev, toDelete->next);
+
+    if (toDelete->prev)
+        toDelete->prev->next = toDelete->next;
+    else
+        root = toDelete->next;
+    if (toDelete->next)
+        toDelete->next->prev = toDelete->prev;
+    else
+        tail = toDelete->prev;
+
+    if (toDelete->next) {
+        cursor = toDelete->next;
+    } else {
+        cursor = toDelete->prev;
+        --cursorIndex;
+    }
+    destroyNode(toDelete);
+    --size;
+    compactIfFragmented();
+}
 
-    if (index == 0) {
-        toDelete = root;
-        root = root->next;
-        if (size == 1) tail = nullptr;
+// Узлы не возвращаются в пул по одному: слэбы освобождаются разом
+template <typename T, typename A>
+void LinkedList<T, A>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        Node* current = root;
+        while (current) {
+            Node* next = current->next;
+            current->~Node();
+            current = next;
+        }
+    }
+    pool.release();
+    root = tail = cursor = nullptr;
+    size = scatteredLinks = 0;
+}
+
+// Вставляет [first, last) перед index. Цепочка новых узлов собирается заранее,
+// так что при исключении список не меняется, а диапазон может указывать в сам список
+template <typename T, typename A>
+template <typename ForwardIt>
+void LinkedList<T, A>::insertRange(int index, ForwardIt first, ForwardIt last) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+    if (first == last) return;
+
+    Node* chainHead = nullptr;
+    Node* chainTail = nullptr;
+    int count = 0;
+    int chainScattered = 0;
+    try {
+        for (; first != last; ++first, ++count) {
+            Node* node = createNode(chainTail, nullptr, *first);
+            if (chainTail) {
+                chainTail->next = node;
+                chainScattered += scattered(chainTail, node);
+            } else {
+                chainHead = node;
+            }
+            chainTail = node;
+        }
+    } catch (...) {
+        while (chainHead) {
+            Node* next = chainHead->next;
+            destroyNode(chainHead);
+            chainHead = next;
+        }
+        throw;
+    }
+
+    Node* next = index == size ? nullptr : nodeAt(index);
+    Node* before = next ? next->prev : tail;
+    if (before && next)
+        chainScattered -= scattered(before, next);
+    if (before) {
+        before->next = chainHead;
+        chainHead->prev = before;
+        chainScattered += scattered(before, chainHead);
+    } else {
+        root = chainHead;
+    }
+    if (next) {
+        next->prev = chainTail;
+        chainTail->next = next;
+        chainScattered += scattered(chainTail, next);
     } else {
-        Node* prev = root;
-        for (int i = 0; i < index - 1; ++i)
-            prev = prev->next;
-        toDelete = prev->next;
-        prev->next = toDelete->next;
-        if (toDelete == tail) tail = prev;
+        tail = chainTail;
     }
 
-    delete toDelete;
-    --size;
+    scatteredLinks += chainScattered;
+    size += count;
+    cursor = chainHead;
+    cursorIndex = index;
+    compactIfFragmented();
 }
 
-template <typename T>
-void LinkedList<T>::clear() {
+// Удаляет полуинтервал [startIndex, endIndex), как DynamicArray::eraseRange
+template <typename T, typename A>
+void LinkedList<T, A>::removeRange(int startIndex, int endIndex) {
+    if (startIndex < 0 || endIndex > size || startIndex > endIndex)
+        throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                     ", End: " + std::to_string(endIndex));
+    if (startIndex == endIndex) return;
+    if (endIndex - startIndex == size) {
+        clear();
+        return;
+    }
+
+    Node* current = nodeAt(startIndex);
+    Node* before = current->prev;
+    if (before)
+        scatteredLinks -= scattered(before, current);
+    for (int i = startIndex; i < endIndex; ++i) {
+        Node* next = current->next;
+        if (next)
+            scatteredLinks -= scattered(current, next);
+        destroyNode(current);
+        current = next;
+    }
+
+    if (before && current)
+        scatteredLinks += scattered(before, current);
+    if (before)
+        before->next = current;
+    else
+        root = current;
+    if (current)
+        current->prev = before;
+    else
+        tail = before;
+
+    size -= endIndex - startIndex;
+    cursor = current ? current : before;
+    cursorIndex = current ? startIndex : startIndex - 1;
+    compactIfFragmented();
+}
+
+// Оставшиеся элементы сохраняют порядок; возвращает число удалённых.
+// Узел отцепляется сразу, так что исключение из predicate оставляет список целым
+template <typename T, typename A>
+template <typename Predicate>
+int LinkedList<T, A>::removeIf(Predicate predicate) {
+    int removed = 0;
+    cursor = nullptr;
     Node* current = root;
     while (current) {
         Node* next = current->next;
-        delete current;
+        if (predicate(current->data)) {
+            Node* before = current->prev;
+            if (before)
+                scatteredLinks -= scattered(before, current);
+            if (next)
+                scatteredLinks -= scattered(current, next);
+            if (before && next)
+                scatteredLinks += scattered(before, next);
+
+            if (before)
+                before->next = next;
+            else
+                root = next;
+            if (next)
+                next->prev = before;
+            else
+                tail = before;
+            destroyNode(current);
+            --size;
+            ++removed;
+        }
         current = next;
     }
-    root = tail = nullptr;
-    size = 0;
+    if (size == 0)
+        clear();
+    compactIfFragmented();
+    return removed;
 }
 
-template <typename T>
-LinkedList<T>* LinkedList<T>::getSubList(int startIndex, int endIndex) const {
+// Узлы переезжают в новый пул с одним слэбом на весь список.
+// Если копирование элемента бросит исключение, список останется прежним
+template <typename T, typename A>
+void LinkedList<T, A>::compact() {
+    if (size == 0) return;
+
+    NodePool<Node, NodeAllocator> fresh(pool.getAllocator());
+    fresh.reserve(size);
+    Node* newRoot = nullptr;
+    Node* newTail = nullptr;
+    try {
+        for (Node* current = root; current; current = current->next) {
+            Node* node = fresh.allocate();
+            ::new (static_cast<void*>(node)) Node(newTail, nullptr, std::move_if_noexcept(current->data));
+            if (newTail)
+                newTail->next = node;
+            else
+                newRoot = node;
+            newTail = node;
+        }
+    } catch (...) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (Node* node = newRoot; node; node = node->next)
+                node->~Node();
+        }
+        throw;
+    }
+
+    int length = size;
+    clear();
+    pool = std::move(fresh);
+    root = newRoot;
+    tail = newTail;
+    size = length;
+}
+
+template <typename T, typename A>
+double LinkedList<T, A>::getFragmentation() const {
+    if (size < 2) return 0.0;
+    return static_cast<double>(scatteredLinks) / (size - 1);
+}
+
+template <typename T, typename A>
+void LinkedList<T, A>::setCompactionThreshold(double threshold) {
+    compactionThreshold = threshold;
+    compactIfFragmented();
+}
+
+// Маленькие списки не уплотняются: им хватает одного-двух слэбов
+template <typename T, typename A>
+void LinkedList<T, A>::compactIfFragmented() {
+    constexpr int MIN_AUTO_COMPACT_SIZE = 64;
+    if (compactionThreshold > 0 && size >= MIN_AUTO_COMPACT_SIZE &&
+        getFragmentation() > compactionThreshold)
+        compact();
+}
+
+// При равных аллокаторах узлы перевешиваются вместе со слэбами за O(1),
+// иначе элементы переносятся по одному
+template <typename T, typename A>
+void LinkedList<T, A>::splice(LinkedList<T, A>&& other) {
+    if (this == &other || other.size == 0)
+        return;
+
+    if (pool.getAllocator() != other.pool.getAllocator()) {
+        for (T& item : other)
+            emplaceBack(std::move(item));
+        other.clear();
+        return;
+    }
+
+    pool.adopt(other.pool);
+    scatteredLinks += other.scatteredLinks;
+    if (tail) {
+        scatteredLinks += scattered(tail, other.root);
+        tail->next = other.root;
+        other.root->prev = tail;
+    } else {
+        root = other.root;
+    }
+    tail = other.tail;
+    size += other.size;
+    other.root = other.tail = other.cursor = nullptr;
+    other.size = other.scatteredLinks = 0;
+}
+
+// Отрезает от цепочки первые count узлов и возвращает начало остатка
+template <typename T, typename A>
+typename LinkedList<T, A>::Node* LinkedList<T, A>::cutChain(Node* head, int count) {
+    for (int i = 1; head && i < count; ++i)
+        head = head->next;
+    if (!head) return nullptr;
+    Node* rest = head->next;
+    head->next = nullptr;
+    return rest;
+}
+
+// Подвешивает цепочку в *out и возвращает ссылку на next её последнего узла
+template <typename T, typename A>
+typename LinkedList<T, A>::Node** LinkedList<T, A>::appendChain(Node** out, Node* chain) {
+    *out = chain;
+    while (*out)
+        out = &(*out)->next;
+    return out;
+}
+
+// После перестановки по next восстанавливает prev, хвост, счётчик разрывов
+// и сбрасывает курсор
+template <typename T, typename A>
+void LinkedList<T, A>::restoreBackLinks() {
+    Node* previous = nullptr;
+    scatteredLinks = 0;
+    for (Node* current = root; current; current = current->next) {
+        current->prev = previous;
+        if (previous)
+            scatteredLinks += scattered(previous, current);
+        previous = current;
+    }
+    tail = previous;
+    cursor = nullptr;
+}
+
+// Снизу вверх: на каждом проходе сливаются соседние отрезки длины width.
+// Если компаратор бросит исключение, куски склеиваются обратно,
+// и список остаётся целым, хотя и частично упорядоченным
+template <typename T, typename A>
+template <typename Compare>
+void LinkedList<T, A>::sort(Compare less) {
+    if (size < 2) return;
+
+    for (int width = 1; width < size; width *= 2) {
+        Node* merged = nullptr;
+        Node** out = &merged;
+        Node* rest = root;
+        while (rest) {
+            Node* left = rest;
+            Node* right = cutChain(left, width);
+            rest = cutChain(right, width);
+            try {
+                while (left && right) {
+                    Node*& smaller = less(right->data, left->data) ? right : left;
+                    *out = smaller;
+                    smaller = smaller->next;
+                    out = &(*out)->next;
+                }
+            } catch (...) {
+                out = appendChain(out, left);
+                out = appendChain(out, right);
+                appendChain(out, rest);
+                root = merged;
+                restoreBackLinks();
+                throw;
+            }
+            out = appendChain(out, left ? left : right);
+        }
+        root = merged;
+    }
+    restoreBackLinks();
+}
+
+template <typename T, typename A>
+LinkedList<T, A>* LinkedList<T, A>::getSubList(int startIndex, int endIndex) const {
     if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
         throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
                                      ", End: " + std::to_string(endIndex));
 
-    LinkedList<T>* result = new LinkedList<T>();
-    Node* current = root;
-    for (int i = 0; i < startIndex; ++i)
-        current = current->next;
+    LinkedList<T, A>* result = new LinkedList<T, A>(getAllocator());
+    Node* current = nodeAt(startIndex);
     for (int i = startIndex; i <= endIndex; ++i) {
         result->append(current->data);
         current = current->next;
@@ -257,15 +786,15 @@ LinkedList<T>* LinkedList<T>::getSubList(int startIndex, int endIndex) const {
     return result;
 }
 
-template <typename T>
-LinkedList<T>* LinkedList<T>::clone() const {
-    return new LinkedList<T>(*this);
+template <typename T, typename A>
+LinkedList<T, A>* LinkedList<T, A>::clone() const {
+    return new LinkedList<T, A>(*this);
 }
 
-template <typename T>
-LinkedList<T>* LinkedList<T>::concat(const LinkedList<T>* other) const {
+template <typename T, typename A>
+LinkedList<T, A>* LinkedList<T, A>::concat(const LinkedList<T, A>* other) const {
     if (!other) throw Errors::nullList();
-    LinkedList<T>* result = new LinkedList<T>(*this);
+    LinkedList<T, A>* result = new LinkedList<T, A>(*this);
     Node* current = other->root;
     while (current) {
         result->append(current->data);
@@ -274,8 +803,16 @@ LinkedList<T>* LinkedList<T>::concat(const LinkedList<T>* other) const {
     return result;
 }
 
-template <typename T>
-bool LinkedList<T>::operator==(const LinkedList<T>& other) const {
+// Копируется только этот список, узлы other забираются целиком
+template <typename T, typename A>
+LinkedList<T, A>* LinkedList<T, A>::concat(LinkedList<T, A>&& other) const {
+    LinkedList<T, A>* result = new LinkedList<T, A>(*this);
+    result->splice(std::move(other));
+    return result;
+}
+
+template <typename T, typename A>
+bool LinkedList<T, A>::operator==(const LinkedList<T, A>& other) const {
     if (size != other.size) return false;
     Node* a = root;
     Node* b = other.root;
@@ -287,7 +824,7 @@ bool LinkedList<T>::operator==(const LinkedList<T>& other) const {
     return true;
 }
 
-template <typename T>
-bool LinkedList<T>::operator!=(const LinkedList<T>& other) const {
+template <typename T, typename A>
+bool LinkedList<T, A>::operator!=(const LinkedList<T, A>& other) const {
     return !(*this == other);
 }
@@ -0,0 +1,308 @@
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "errors.hpp"
+
+enum class MappingMode {
+    ReadOnly,
+    ReadWrite
+};
+
+// Массив поверх отображённого в память файла: элементы лежат прямо в файле,
+// ввод-вывод выполняет страничный кэш ОС. Длина файла всегда кратна sizeof(T).
+// В режиме ReadWrite файл создаётся при отсутствии, растёт через ftruncate + mremap
+// и при закрытии обрезается до getSize() элементов
+template <typename T>
+class MappedArray {
+private:
+    static_assert(std::is_trivially_copyable_v<T>, "MappedArray requires a trivially copyable type");
+
+    int descriptor;
+    MappingMode mode;
+    T* elements;
+    int size;
+    int capacity;
+
+    static constexpr double GROWTH_FACTOR = 1.5;
+
+    static BaseError systemError(const std::string& what) {
+        return Errors::ioError(what + ": " + std::strerror(errno));
+    }
+
+    void requireWritable() const {
+        if (mode == MappingMode::ReadOnly) throw Errors::immutable("Read-only mapping");
+    }
+
+    void remap(int newCapacity);
+    void grow(int requiredCapacity);
+    void close() noexcept;
+
+public:
+    explicit MappedArray(const std::string& path, MappingMode mode = MappingMode::ReadWrite);
+
+    MappedArray(const MappedArray&) = delete;
+    MappedArray& operator=(const MappedArray&) = delete;
+
+    MappedArray(MappedArray&& other) noexcept;
+    MappedArray& operator=(MappedArray&& other) noexcept;
+
+    ~MappedArray();
+
+    T get(int index) const;
+    void set(int index, const T& value);
+
+    // Без проверки индекса
+    const T& unsafeGet(int index) const { return elements[index]; }
+    void unsafeSet(int index, const T& value) { elements[index] = value; }
+
+    int getSize() const { return size; }
+    int getCapacity() const { return capacity; }
+    bool isReadOnly() const { return mode == MappingMode::ReadOnly; }
+
+    T* data();
+    const T* data() const { return elements; }
+    const T* begin() const { return elements; }
+    const T* end() const { return elements + size; }
+
+    void reserve(int newCapacity);
+    void resize(int newSize);
+    void pushBack(const T& value);
+    void popBack();
+    void insertAt(int index, const T& value);
+    void remove(int index);
+    void clear();
+
+    // Синхронно сбрасывает изменённые страницы на диск и обрезает файл до getSize() элементов
+    void flush();
+
+    T& operator[](int index);
+    const T& operator[](int index) const;
+};
+
+template <typename T>
+MappedArray<T>::MappedArray(const std::string& path, MappingMode mode)
+    : descriptor(-1), mode(mode), elements(nullptr), size(0), capacity(0)
+{
+    int flags = mode == MappingMode::ReadOnly ? O_RDONLY : O_RDWR | O_CREAT;
+    descriptor = ::open(path.c_str(), flags, 0644);
+    if (descriptor < 0) throw systemError("Cannot open " + path);
+
+    struct stat info;
+    if (::fstat(descriptor, &info) != 0) {
+        BaseError error = systemError("Cannot stat " + path);
+        ::close(descriptor);
+        throw error;
+    }
+
+    std::size_t bytes = static_cast<std::size_t>(info.st_size);
+    if (bytes % sizeof(T) != 0 || bytes / sizeof(T) > static_cast<std::size_t>(INT_MAX)) {
+        ::close(descriptor);
+        throw Errors::invalidArgument("File size does not match element size");
+    }
+
+    try {
+        remap(static_cast<int>(bytes / sizeof(T)));
+    } catch (...) {
+        ::close(descriptor);
+        throw;
+    }
+    size = capacity;
+}
+
+template <typename T>
+MappedArray<T>::MappedArray(MappedArray&& other) noexcept
+    : descriptor(other.descriptor), mode(other.mode), elements(other.elements),
+      size(other.size), capacity(other.capacity)
+{
+    other.descriptor = -1;
+    other.elements = nullptr;
+    other.size = other.capacity = 0;
+}
+
+template <typename T>
+MappedArray<T>& MappedArray<T>::operator=(MappedArray&& other) noexcept {
+    if (this != &other) {
+        close();
+        descriptor = other.descriptor;
+        mode = other.mode;
+        elements = other.elements;
+        size = other.size;
+        capacity = other.capacity;
+        other.descriptor = -1;
+        other.elements = nullptr;
+        other.size = other.capacity = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+MappedArray<T>::~MappedArray() {
+    close();
+}
+
+// Отображает первые newCapacity элементов файла; файл уже должен быть нужной длины
+template <typename T>
+void MappedArray<T>::remap(int newCapacity) {
+    std::size_t oldBytes = sizeof(T) * capacity;
+    std::size_t newBytes = sizeof(T) * newCapacity;
+    void* mapped = MAP_FAILED;
+
+    if (newBytes == 0) {
+        if (elements) ::munmap(elements, oldBytes);
+        elements = nullptr;
+        capacity = 0;
+        return;
+    }
+
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+    if (elements)
+        mapped = ::mremap(elements, oldBytes, newBytes, MREMAP_MAYMOVE);
+    else
+#endif
+    {
+        int protection = mode == MappingMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+        mapped = ::mmap(nullptr, newBytes, protection, MAP_SHARED, descriptor, 0);
+        if (mapped != MAP_FAILED && elements)
+            ::munmap(elements, oldBytes);
+    }
+
+    if (mapped == MAP_FAILED) throw systemError("Cannot map file");
+    elements = static_cast<T*>(mapped);
+    capacity = newCapacity;
+}
+
+template <typename T>
+void MappedArray<T>::grow(int requiredCapacity) {
+    if (requiredCapacity <= capacity) return;
+    int newCapacity = static_cast<int>(capacity * GROWTH_FACTOR);
+    if (newCapacity < requiredCapacity) newCapacity = requiredCapacity;
+    reserve(newCapacity);
+}
+
+template <typename T>
+void MappedArray<T>::close() noexcept {
+    if (elements) ::munmap(elements, sizeof(T) * capacity);
+    if (descriptor >= 0) {
+        if (mode == MappingMode::ReadWrite && size != capacity)
+            (void)::ftruncate(descriptor, static_cast<off_t>(sizeof(T) * size));
+        ::close(descriptor);
+    }
+    descriptor = -1;
+    elements = nullptr;
+    size = capacity = 0;
+}
+
+template <typename T>
+T MappedArray<T>::get(int index) const {
+    if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+    return elements[index];
+}
+
+template <typename T>
+void MappedArray<T>::set(int index, const T& value) {
+    requireWritable();
+    if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+    elements[index] = value;
+}
+
+template <typename T>
+T* MappedArray<T>::data() {
+    requireWritable();
+    return elements;
+}
+
+template <typename T>
+void MappedArray<T>::reserve(int newCapacity) {
+    requireWritable();
+    if (newCapacity <= capacity) return;
+    if (::ftruncate(descriptor, static_cast<off_t>(sizeof(T) * newCapacity)) != 0)
+        throw systemError("Cannot extend file");
+    remap(newCapacity);
+}
+
+// Новые элементы заполняются нулями, как и новая часть файла
+template <typename T>
+void MappedArray<T>::resize(int newSize) {
+    requireWritable();
+    if (newSize < 0) throw Errors::negativeSize();
+    grow(newSize);
+    if (newSize > size)
+        std::memset(static_cast<void*>(elements + size), 0, sizeof(T) * (newSize - size));
+    size = newSize;
+}
+
+template <typename T>
+void MappedArray<T>::pushBack(const T& value) {
+    requireWritable();
+    grow(size + 1);
+    elements[size++] = value;
+}
+
+template <typename T>
+void MappedArray<T>::popBack() {
+    requireWritable();
+    if (size == 0) throw Errors::emptyArray();
+    --size;
+}
+
+template <typename T>
+void MappedArray<T>::insertAt(int index, const T& value) {
+    requireWritable();
+    if (index < 0 || index > size) throw Errors::indexOutOfRange();
+    T copy = value;
+    grow(size + 1);
+    std::memmove(static_cast<void*>(elements + index + 1), elements + index, sizeof(T) * (size - index));
+    elements[index] = copy;
+    ++size;
+}
+
+template <typename T>
+void MappedArray<T>::remove(int index) {
+    requireWritable();
+    if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+    std::memmove(static_cast<void*>(elements + index), elements + index + 1, sizeof(T) * (size - index - 1));
+    --size;
+}
+
+template <typename T>
+void MappedArray<T>::clear() {
+    requireWritable();
+    size = 0;
+}
+
+template <typename T>
+void MappedArray<T>::flush() {
+    if (elements && ::msync(elements, sizeof(T) * capacity, MS_SYNC) != 0)
+        throw systemError("Cannot sync mapping");
+    if (mode == MappingMode::ReadWrite && size != capacity) {
+        remap(size);
+        if (::ftruncate(descriptor, static_cast<off_t>(sizeof(T) * size)) != 0)
+            throw systemError("Cannot truncate file");
+    }
+}
+
+template <typename T>
+T& MappedArray<T>::operator[](int index) {
+    requireWritable();
+    if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+    return elements[index];
+}
+
+template <typename T>
+const T& MappedArray<T>::operator[](int index) const {
+    if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+    return elements[index];
+}
+
+#endif
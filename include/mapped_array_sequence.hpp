@@ -0,0 +1,173 @@
+#pragma once
+
+#include "mapped_array.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include "sequence.hpp"
+#include "mutable_array_sequence.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+
+// Последовательность поверх файла. Изменения пишутся прямо в файл,
+// а производные последовательности (map, where, concat, ...) строятся в куче
+// как MutableArraySequence<T>, поскольку у них нет собственного файла
+template <typename T>
+class MappedArraySequence : public Sequence<T> {
+private:
+    MappedArray<T> items;
+
+    using Result = MutableArraySequence<T>;
+
+public:
+    explicit MappedArraySequence(const std::string& path, MappingMode mode = MappingMode::ReadWrite)
+        : items(path, mode) {}
+
+    explicit MappedArraySequence(MappedArray<T>&& array)
+        : items(std::move(array)) {}
+
+    MappedArraySequence(MappedArraySequence&& other) = default;
+    MappedArraySequence& operator=(MappedArraySequence&& other) = default;
+
+    ~MappedArraySequence() override = default;
+
+    T getFirst() const override {
+        if (getLength() == 0) throw Errors::emptyArray();
+        return items.unsafeGet(0);
+    }
+
+    T getLast() const override {
+        if (getLength() == 0) throw Errors::emptyArray();
+        return items.unsafeGet(getLength() - 1);
+    }
+
+    T get(int index) const override {
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+        return items.unsafeGet(index);
+    }
+
+    int getLength() const override {
+        return items.getSize();
+    }
+
+    bool isReadOnly() const {
+        return items.isReadOnly();
+    }
+
+    void reserve(int capacity) {
+        items.reserve(capacity);
+    }
+
+    void flush() {
+        items.flush();
+    }
+
+    const T* data() const {
+        return items.data();
+    }
+
+    T& operator[](int index) override {
+        return items[index];
+    }
+
+    const T& operator[](int index) const override {
+        return items[index];
+    }
+
+    Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0 || endIndex >= getLength() || startIndex > endIndex)
+            throw Errors::invalidIndices();
+
+        DynamicArray<T> sub;
+        sub.reserve(endIndex - startIndex + 1);
+        for (int i = startIndex; i <= endIndex; ++i)
+            sub.pushBack(items.unsafeGet(i));
+        return new Result(std::move(sub));
+    }
+
+    Sequence<T>* append(T item) override {
+        items.pushBack(item);
+        return this;
+    }
+
+    Sequence<T>* prepend(T item) override {
+        items.insertAt(0, item);
+        return this;
+    }
+
+    Sequence<T>* insertAt(T item, int index) override {
+        items.insertAt(index, item);
+        return this;
+    }
+
+    Sequence<T>* remove(int index) override {
+        if (getLength() == 0) throw Errors::emptyArray();
+        items.remove(index);
+        return this;
+    }
+
+    Sequence<T>* concat(const Sequence<T>* other) const override {
+        if (!other) throw Errors::invalidArgument();
+
+        DynamicArray<T> combined;
+        combined.reserve(getLength() + other->getLength());
+        for (const T& item : items)
+            combined.pushBack(item);
+        for (int i = 0; i < other->getLength(); ++i)
+            combined.pushBack(other->get(i));
+        return new Result(std::move(combined));
+    }
+
+    // Копия не привязана к файлу
+    Sequence<T>* clone() const override {
+        DynamicArray<T> copy;
+        copy.reserve(getLength());
+        for (const T& item : items)
+            copy.pushBack(item);
+        return new Result(std::move(copy));
+    }
+
+    Sequence<T>* map(std::function<T(T)> f) const override {
+        DynamicArray<T> mapped;
+        mapped.reserve(getLength());
+        for (const T& item : items)
+            mapped.pushBack(f(item));
+        return new Result(std::move(mapped));
+    }
+
+    Sequence<T>* where(std::function<bool(T)> predicate) const override {
+        DynamicArray<T> filtered;
+        for (const T& item : items)
+            if (predicate(item))
+                filtered.pushBack(item);
+        return new Result(std::move(filtered));
+    }
+
+    T reduce(std::function<T(T, T)> reducer, T initial) const override {
+        T acc = initial;
+        for (const T& item : items)
+            acc = reducer(acc, item);
+        return acc;
+    }
+
+    Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
+        int len = std::min(getLength(), other->getLength());
+        DynamicArray<T> result;
+        result.reserve(len);
+        for (int i = 0; i < len; ++i)
+            result.pushBack(combiner(items.unsafeGet(i), other->get(i)));
+        return new Result(std::move(result));
+    }
+
+    Sequence<T>* slice(int start, int end) const override {
+        if (start < 0) start = 0;
+        if (end > getLength()) end = getLength();
+        if (start >= end) return new Result();
+        return getSubsequence(start, end - 1);
+    }
+};
+
+#endif
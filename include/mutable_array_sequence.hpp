@@ -2,220 +2,226 @@
 
 #include "sequence.hpp"
 #include "dynamic_array.hpp"
+#include "sequence_view.hpp"
 
 #include <functional>
 #include <stdexcept>
 #include <algorithm>
 #include <utility>
 
-template <typename T>
+template <typename T, typename Storage = DynamicArray<T>>
 class MutableArraySequence : public Sequence<T> {
 private:
-    DynamicArray<T>* items;
-    int length;  
-    static constexpr double GROWTH_FACTOR = 1.5;
-
-    void ensureCapacity(int requiredCapacity) {
-        if (items->getSize() >= requiredCapacity) return;
-        
-        int newCapacity = std::max(requiredCapacity, 
-                                  static_cast<int>(items->getSize() * GROWTH_FACTOR) + 1);
-        items->resize(newCapacity);
-    }
+    Storage items;
 
 public:
-    MutableArraySequence() : items(new DynamicArray<T>(1)), length(0) {} 
+    using View = SequenceView<T, typename Storage::allocator_type>;
+
+    MutableArraySequence() = default;
 
     explicit MutableArraySequence(T* array, int count)
-        : items(new DynamicArray<T>(count)), length(count) {
-        for (int i = 0; i < count; ++i) {
-            items->set(i, array[i]);
-        }
-    }
+        : items(array, count) {}
+
+    explicit MutableArraySequence(const Storage& array)
+        : items(array) {}
 
-    explicit MutableArraySequence(const DynamicArray<T>& array)
-        : items(new DynamicArray<T>(array)), length(array.getSize()) {}
+    explicit MutableArraySequence(Storage&& array)
+        : items(std::move(array)) {}
 
-    MutableArraySequence(const MutableArraySequence<T>& other)
-        : items(new DynamicArray<T>(*other.items)), length(other.length) {}
+    MutableArraySequence(const MutableArraySequence& other) = default;
+    MutableArraySequence(MutableArraySequence&& other) = default;
 
-    MutableArraySequence(MutableArraySequence<T>&& other) noexcept
-        : items(other.items), length(other.length) {
-        other.items = nullptr;
-        other.length = 0;
+    MutableArraySequence& operator=(const MutableArraySequence& other) = default;
+    MutableArraySequence& operator=(MutableArraySequence&& other) = default;
+
+    ~MutableArraySequence() override = default;
+
+    T getFirst() const override {
+        if (getLength() == 0) throw Errors::emptyArray();
+        return items.unsafeGet(0);
     }
 
-    MutableArraySequence<T>& operator=(const MutableArraySequence<T>& other) {
-        if (this != &other) {
-            delete items;
-            items = new DynamicArray<T>(*other.items);
-            length = other.length;
-        }
-        return *this;
+    T getLast() const override {
+        if (getLength() == 0) throw Errors::emptyArray();
+        return items.unsafeGet(getLength() - 1);
     }
 
-    MutableArraySequence<T>& operator=(MutableArraySequence<T>&& other) noexcept {
-        if (this != &other) {
-            delete items;
-            items = other.items;
-            length = other.length;
-            other.items = nullptr;
-            other.length = 0;
-        }
-        return *this;
+    T get(int index) const override {
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+        return items.unsafeGet(index);
     }
 
-    ~MutableArraySequence() override {
-        delete items;
+    typename Storage::allocator_type getAllocator() const {
+        return items.getAllocator();
     }
 
-    T getFirst() const override {
-        if (length == 0) throw Errors::emptyArray();
-        return items->get(0);
+    int getLength() const override {
+        return items.getSize();
     }
 
-    T getLast() const override {
-        if (length == 0) throw Errors::emptyArray();
-        return items->get(length - 1);
+    int getCapacity() const {
+        return items.getCapacity();
     }
 
-    T get(int index) const override {
-        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
-        return items->get(index);
+    void reserve(int capacity) {
+        items.reserve(capacity);
     }
 
-    int getLength() const override {
-        return length;
+    void shrinkToFit() {
+        items.shrinkToFit();
     }
 
     T& operator[](int index) override {
-        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
-        return (*items)[index];
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+        return items.data()[index];
     }
 
     const T& operator[](int index) const override {
-        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
-        return (*items)[index];
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+        return items.data()[index];
+    }
+
+    // Непрерывный буфер длиной getLength(); инвалидируется при любом изменении размера
+    T* data() {
+        return items.data();
+    }
+
+    const T* data() const {
+        return items.data();
     }
 
+    // Независимая копия; для окна без копирования есть view()
     Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
-        if (startIndex < 0 || endIndex >= length || startIndex > endIndex) 
+        if (startIndex < 0 || endIndex >= getLength() || startIndex > endIndex)
             throw Errors::invalidIndices();
 
-        DynamicArray<T>* sub = items->getSubArray(startIndex, endIndex);
-        auto* result = new MutableArraySequence<T>(*sub);
-        delete sub;
-        return result;
+        Storage sub(items.getAllocator());
+        sub.reserve(endIndex - startIndex + 1);
+        sub.appendRange(items, startIndex, endIndex - startIndex + 1);
+        return new MutableArraySequence(std::move(sub));
+    }
+
+    // Окно над элементами [startIndex, endIndex] без копирования; правила
+    // инвалидации те же, что у data(), подробнее в SequenceView
+    View view(int startIndex, int endIndex) const {
+        if (startIndex < 0 || endIndex >= getLength() || startIndex > endIndex)
+            throw Errors::invalidIndices();
+        return View(items.data() + startIndex, endIndex - startIndex + 1, items.getAllocator());
     }
 
     Sequence<T>* append(T item) override {
-        ensureCapacity(length + 1);
-        items->set(length, item);
-        length++;
+        items.pushBack(std::move(item));
         return this;
     }
 
     Sequence<T>* prepend(T item) override {
-        ensureCapacity(length + 1);
-        for (int i = length; i > 0; --i) {
-            items->set(i, items->get(i - 1));
-        }
-        items->set(0, item);
-        length++;
+        items.insertAt(0, std::move(item));
         return this;
     }
 
     Sequence<T>* insertAt(T item, int index) override {
-        if (index < 0 || index > length) throw Errors::indexOutOfRange();
-        
-        ensureCapacity(length + 1);
-        for (int i = length; i > index; --i) {
-            items->set(i, items->get(i - 1));
-        }
-        items->set(index, item);
-        length++;
+        if (index < 0 || index > getLength()) throw Errors::indexOutOfRange();
+        items.insertAt(index, std::move(item));
         return this;
     }
 
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {
+        return items.emplaceBack(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        return items.emplace(0, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    T& emplace(int index, Args&&... args) {
+        if (index < 0 || index > getLength()) throw Errors::indexOutOfRange();
+        return items.emplace(index, std::forward<Args>(args)...);
+    }
+
     Sequence<T>* remove(int index) override {
-        if (length == 0) throw Errors::emptyArray();
-        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
-        
-        for (int i = index; i < length - 1; ++i) {
-            items->set(i, items->get(i + 1));
-        }
-        length--;
+        if (getLength() == 0) throw Errors::emptyArray();
+        if (index < 0 || index >= getLength()) throw Errors::indexOutOfRange();
+        items.remove(index);
         return this;
     }
 
+    template <typename ForwardIt>
+    Sequence<T>* insertRange(int index, ForwardIt first, ForwardIt last) {
+        items.insertRange(index, first, last);
+        return this;
+    }
+
+    // Удаляет элементы с индексами из [startIndex, endIndex)
+    Sequence<T>* eraseRange(int startIndex, int endIndex) {
+        items.eraseRange(startIndex, endIndex);
+        return this;
+    }
+
+    template <typename Predicate>
+    int removeIf(Predicate predicate) {
+        return items.removeIf(predicate);
+    }
+
     Sequence<T>* concat(const Sequence<T>* other) const override {
-        const auto* otherArray = dynamic_cast<const MutableArraySequence<T>*>(other);
+        const auto* otherArray = dynamic_cast<const MutableArraySequence*>(other);
         if (!otherArray) throw Errors::incompatibleTypes();
 
-        int totalSize = length + otherArray->length;
-        DynamicArray<T> combined(totalSize);
+        Storage combined(items.getAllocator());
+        combined.reserve(getLength() + otherArray->getLength());
 
-        for (int i = 0; i < length; ++i)
-            combined.set(i, get(i));
-        for (int j = 0; j < otherArray->length; ++j)
-            combined.set(j + length, otherArray->get(j));
+        combined.appendRange(items, 0, getLength());
+        combined.appendRange(otherArray->items, 0, otherArray->getLength());
 
-        auto* result = new MutableArraySequence<T>();
-        delete result->items;  // Удаляем пустой массив
-        result->items = new DynamicArray<T>(combined);
-        result->length = totalSize;
-        return result;
+        return new MutableArraySequence(std::move(combined));
     }
 
     Sequence<T>* clone() const override {
-        return new MutableArraySequence<T>(*this);
+        return new MutableArraySequence(*this);
     }
 
     Sequence<T>* map(std::function<T(T)> f) const override {
-        DynamicArray<T> mapped(length);
-        for (int i = 0; i < length; ++i)
-            mapped.set(i, f(get(i)));
-        auto* result = new MutableArraySequence<T>(mapped);
-        result->length = length;
-        return result;
+        Storage mapped(items.getAllocator());
+        mapped.reserve(getLength());
+        for (const T& item : items)
+            mapped.pushBack(f(item));
+        return new MutableArraySequence(std::move(mapped));
     }
 
     Sequence<T>* where(std::function<bool(T)> predicate) const override {
-        DynamicArray<T> filtered(length);
-        int count = 0;
-        for (int i = 0; i < length; ++i)
-            if (predicate(get(i)))
-                filtered.set(count++, get(i));
-
-        DynamicArray<T> result(count);
-        for (int i = 0; i < count; ++i)
-            result.set(i, filtered.get(i));
-        auto* seq = new MutableArraySequence<T>(result);
-        seq->length = count;
-        return seq;
+        Storage filtered(items.getAllocator());
+        for (const T& item : items)
+            if (predicate(item))
+                filtered.pushBack(item);
+        return new MutableArraySequence(std::move(filtered));
     }
 
     T reduce(std::function<T(T, T)> reducer, T initial) const override {
         T acc = initial;
-        for (int i = 0; i < length; ++i)
-            acc = reducer(acc, get(i));
+        for (const T& item : items)
+            acc = reducer(acc, item);
         return acc;
     }
 
     Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
-        int len = std::min(length, other->getLength());
-        DynamicArray<T> result(len);
+        int len = std::min(getLength(), other->getLength());
+        Storage result(items.getAllocator());
+        result.reserve(len);
         for (int i = 0; i < len; ++i)
-            result.set(i, combiner(get(i), other->get(i)));
-        auto* seq = new MutableArraySequence<T>(result);
-        seq->length = len;
-        return seq;
+            result.pushBack(combiner(items.unsafeGet(i), other->get(i)));
+        return new MutableArraySequence(std::move(result));
     }
 
     Sequence<T>* slice(int start, int end) const override {
         if (start < 0) start = 0;
-        if (end > length) end = length;
-        if (start >= end) return new MutableArraySequence<T>();
+        if (end > getLength()) end = getLength();
+        if (start >= end) return new MutableArraySequence(Storage(items.getAllocator()));
         return getSubsequence(start, end - 1);
     }
-};
\ No newline at end of file
+};
+
+// Последовательность, которая держит до InlineCapacity элементов без обращений к куче
+template <typename T, int InlineCapacity = 16>
+using SmallArraySequence = MutableArraySequence<T, SmallDynamicArray<T, InlineCapacity>>;
\ No newline at end of file
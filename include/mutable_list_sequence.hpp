@@ -2,6 +2,8 @@
 
 #include "sequence.hpp"
 #include "linked_list.hpp"
+#include "unrolled_linked_list.hpp"
+#include "compact_linked_list.hpp"
 
 #include <functional>
 #include <stdexcept>
@@ -9,37 +11,40 @@
 #include <iterator>
 #include <algorithm>
 
-template <typename T>
+template <typename T, typename List = LinkedList<T>>
 class MutableListSequence : public Sequence<T> {
 protected:
-    LinkedList<T>* list;
+    List* list;
 
 public:
-    MutableListSequence() : list(new LinkedList<T>()) {}
+    MutableListSequence() : list(new List()) {}
 
     explicit MutableListSequence(T* items, int count)
-        : list(new LinkedList<T>(items, count)) {}
+        : list(new List(items, count)) {}
+
+    explicit MutableListSequence(const List& source)
+        : list(new List(source)) {}
 
-    explicit MutableListSequence(const LinkedList<T>& source)
-        : list(new LinkedList<T>(source)) {}
+    explicit MutableListSequence(List&& source)
+        : list(new List(std::move(source))) {}
 
-    MutableListSequence(const MutableListSequence<T>& other)
-        : list(new LinkedList<T>(*other.list)) {}
+    MutableListSequence(const MutableListSequence& other)
+        : list(new List(*other.list)) {}
 
-    MutableListSequence(MutableListSequence<T>&& other) noexcept
+    MutableListSequence(MutableListSequence&& other) noexcept
         : list(other.list) {
         other.list = nullptr;
     }
 
-    MutableListSequence<T>& operator=(const MutableListSequence<T>& other) {
+    MutableListSequence& operator=(const MutableListSequence& other) {
         if (this != &other) {
             delete list;
-            list = new LinkedList<T>(*other.list);
+            list = new List(*other.list);
         }
         return *this;
     }
 
-    MutableListSequence<T>& operator=(MutableListSequence<T>&& other) noexcept {
+    MutableListSequence& operator=(MutableListSequence&& other) noexcept {
         if (this != &other) {
             delete list;
             list = other.list;
@@ -72,86 +77,148 @@ public:
         return (*list)[index];
     }
 
+    typename List::allocator_type getAllocator() const {
+        return list->getAllocator();
+    }
+
     int getLength() const override {
         return list->getLength();
     }
 
     Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
-        LinkedList<T>* sub = list->getSubList(startIndex, endIndex);
-        auto* result = new MutableListSequence<T>(*sub);
+        List* sub = list->getSubList(startIndex, endIndex);
+        auto* result = new MutableListSequence(std::move(*sub));
         delete sub;
         return result;
     }
 
     Sequence<T>* append(T item) override {
-        list->append(item);
+        list->append(std::move(item));
         return this;
     }
 
     Sequence<T>* prepend(T item) override {
-        list->prepend(item);
+        list->prepend(std::move(item));
         return this;
     }
 
     Sequence<T>* insertAt(T item, int index) override {
-        list->insertAt(item, index);
+        list->insertAt(std::move(item), index);
         return this;
     }
 
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {
+        return list->emplaceBack(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        return list->emplaceFront(std::forward<Args>(args)...);
+    }
+
     Sequence<T>* remove(int index) override {
         if (list->getLength() == 0) throw Errors::emptyList();
         list->remove(index);
         return this;
     }
 
+    template <typename ForwardIt>
+    Sequence<T>* insertRange(int index, ForwardIt first, ForwardIt last) {
+        list->insertRange(index, first, last);
+        return this;
+    }
+
+    // Удаляет элементы с индексами из [startIndex, endIndex)
+    Sequence<T>* removeRange(int startIndex, int endIndex) {
+        list->removeRange(startIndex, endIndex);
+        return this;
+    }
+
+    template <typename Predicate>
+    int removeIf(Predicate predicate) {
+        return list->removeIf(predicate);
+    }
+
     Sequence<T>* concat(const Sequence<T>* other) const override {
-        const auto* otherList = dynamic_cast<const MutableListSequence<T>*>(other);
+        const auto* otherList = dynamic_cast<const MutableListSequence*>(other);
         if (!otherList) throw Errors::incompatibleTypes();
 
-        LinkedList<T>* resultList = list->concat(otherList->list);
-        auto* result = new MutableListSequence<T>(*resultList);
+        List* resultList = list->concat(otherList->list);
+        auto* result = new MutableListSequence(std::move(*resultList));
         delete resultList;
         return result;
     }
 
+    // Забирает узлы other без копирования, other остаётся пустой
+    Sequence<T>* concatInPlace(MutableListSequence&& other) {
+        list->splice(std::move(*other.list));
+        return this;
+    }
+
+    Sequence<T>* append(MutableListSequence&& other) {
+        return concatInPlace(std::move(other));
+    }
+
+    // Порядок меняется перестановкой узлов, без копирования элементов
+    template <typename Compare = std::less<>>
+    Sequence<T>* sort(Compare less = Compare()) {
+        list->sort(less);
+        return this;
+    }
+
+    // Переукладывает узлы списка подряд в порядке обхода
+    void compact() {
+        list->compact();
+    }
+
     Sequence<T>* clone() const override {
-        return new MutableListSequence<T>(*this);
+        return new MutableListSequence(*this);
     }
 
     Sequence<T>* map(std::function<T(T)> f) const override {
-        LinkedList<T> result;
-        for (int i = 0; i < getLength(); ++i)
-            result.append(f(get(i)));
-        return new MutableListSequence<T>(result);
+        List result(list->getAllocator());
+        for (const T& item : *list)
+            result.append(f(item));
+        return new MutableListSequence(std::move(result));
     }
 
     Sequence<T>* where(std::function<bool(T)> predicate) const override {
-        LinkedList<T> result;
-        for (int i = 0; i < getLength(); ++i)
-            if (predicate(get(i)))
-                result.append(get(i));
-        return new MutableListSequence<T>(result);
+        List result(list->getAllocator());
+        for (const T& item : *list)
+            if (predicate(item))
+                result.append(item);
+        return new MutableListSequence(std::move(result));
     }
 
     T reduce(std::function<T(T, T)> reducer, T initial) const override {
         T acc = initial;
-        for (int i = 0; i < getLength(); ++i)
-            acc = reducer(acc, get(i));
+        for (const T& item : *list)
+            acc = reducer(acc, item);
         return acc;
     }
 
     Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
         int len = std::min(getLength(), other->getLength());
-        LinkedList<T> result;
-        for (int i = 0; i < len; ++i)
-            result.append(combiner(get(i), other->get(i)));
-        return new MutableListSequence<T>(result);
+        List result(list->getAllocator());
+        auto it = list->begin();
+        for (int i = 0; i < len; ++i, ++it)
+            result.append(combiner(*it, other->get(i)));
+        return new MutableListSequence(std::move(result));
     }
     
     Sequence<T>* slice(int start, int end) const override {
         if (start < 0) start = 0;
         if (end > getLength()) end = getLength();
-        if (start >= end) return new MutableListSequence<T>();
+        if (start >= end) return new MutableListSequence(List(list->getAllocator()));
         return getSubsequence(start, end - 1);
     }
 };
+
+// Списочная последовательность на развёрнутом списке: несколько элементов в узле
+template <typename T>
+using UnrolledListSequence = MutableListSequence<T, UnrolledLinkedList<T>>;
+
+// Списочная последовательность на компактном списке: узлы в одном массиве, связи по индексам
+template <typename T>
+using CompactListSequence = MutableListSequence<T, CompactLinkedList<T>>;
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+
+struct PoolStats {
+    int slabs;
+    int capacity;
+    int used;
+};
+
+// Пул узлов одного контейнера: память берётся у NodeAllocator слэбами,
+// освобождённые узлы уходят в свободный список и переиспользуются,
+// а release() возвращает все слэбы разом.
+// Пул раздаёт только сырую память: создавать и уничтожать Node должен владелец
+template <typename Node, typename NodeAllocator>
+class NodePool {
+private:
+    using Traits = std::allocator_traits<NodeAllocator>;
+
+    // Заголовок слэба лежит в его первой ячейке
+    struct SlabHeader {
+        SlabHeader* previous;
+        int count;
+    };
+
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    static_assert(sizeof(Node) >= sizeof(SlabHeader), "Node is too small for a slab header");
+    static_assert(sizeof(Node) >= sizeof(FreeSlot), "Node is too small for a free list link");
+
+    static constexpr int MIN_SLAB_NODES = 16;
+    static constexpr int MAX_SLAB_NODES = 1024;
+
+    NodeAllocator allocator;
+    SlabHeader* slabs;
+    SlabHeader* oldestSlab;
+    FreeSlot* freeList;
+    FreeSlot* freeTail;
+    Node* cursor;
+    Node* end;
+    int nextSlabNodes;
+    int slabCount;
+    int capacity;
+    int used;
+
+    void addSlab(int nodes) {
+        int count = nodes + 1;
+        Node* slab = Traits::allocate(allocator, static_cast<std::size_t>(count));
+        slabs = ::new (static_cast<void*>(slab)) SlabHeader{slabs, count};
+        if (!oldestSlab)
+            oldestSlab = slabs;
+        cursor = slab + 1;
+        end = slab + count;
+        ++slabCount;
+        capacity += nodes;
+    }
+
+    void pushFree(Node* node) noexcept {
+        freeList = ::new (static_cast<void*>(node)) FreeSlot{freeList};
+        if (!freeTail)
+            freeTail = freeList;
+    }
+
+    void reset() noexcept {
+        slabs = oldestSlab = nullptr;
+        freeList = freeTail = nullptr;
+        cursor = end = nullptr;
+        nextSlabNodes = MIN_SLAB_NODES;
+        slabCount = capacity = used = 0;
+    }
+
+public:
+    explicit NodePool(const NodeAllocator& allocator = NodeAllocator())
+        : allocator(allocator) {
+        reset();
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NodePool(NodePool&& other) noexcept : allocator(other.allocator) {
+        reset();
+        swap(other);
+    }
+
+    // Вызывающий отвечает за совместимость аллокаторов
+    NodePool& operator=(NodePool&& other) noexcept {
+        if (this != &other) {
+            release();
+            allocator = other.allocator;
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~NodePool() {
+        release();
+    }
+
+    void swap(NodePool& other) noexcept {
+        std::swap(slabs, other.slabs);
+        std::swap(oldestSlab, other.oldestSlab);
+        std::swap(freeList, other.freeList);
+        std::swap(freeTail, other.freeTail);
+        std::swap(cursor, other.cursor);
+        std::swap(end, other.end);
+        std::swap(nextSlabNodes, other.nextSlabNodes);
+        std::swap(slabCount, other.slabCount);
+        std::swap(capacity, other.capacity);
+        std::swap(used, other.used);
+    }
+
+    Node* allocate() {
+        Node* node;
+        if (freeList) {
+            node = reinterpret_cast<Node*>(freeList);
+            freeList = freeList->next;
+            if (!freeList)
+                freeTail = nullptr;
+        } else {
+            if (cursor == end) {
+                addSlab(nextSlabNodes);
+                nextSlabNodes = std::min(nextSlabNodes * 2, MAX_SLAB_NODES);
+            }
+            node = cursor++;
+        }
+        ++used;
+        return node;
+    }
+
+    void deallocate(Node* node) noexcept {
+        pushFree(node);
+        --used;
+    }
+
+    // Заводит слэб ровно на count узлов, и следующие узлы выдаются из него подряд.
+    // Свободный список расходуется раньше, так что подряд узлы лягут только в пустом пуле
+    void reserve(int count) {
+        if (count <= 0) return;
+        for (Node* slot = cursor; slot != end; ++slot)
+            pushFree(slot);
+        addSlab(count);
+    }
+
+    // Все выданные узлы становятся недействительными
+    void release() noexcept {
+        while (slabs) {
+            SlabHeader* previous = slabs->previous;
+            Traits::deallocate(allocator, reinterpret_cast<Node*>(slabs), static_cast<std::size_t>(slabs->count));
+            slabs = previous;
+        }
+        reset();
+    }
+
+    // Забирает слэбы другого пула, чтобы его узлы можно было освобождать через этот.
+    // Списки слэбов и свободных узлов склеиваются за O(1),
+    // остаток текущего слэба (не больше MAX_SLAB_NODES ячеек) уходит в свободный список.
+    // Аллокаторы пулов должны быть равны
+    void adopt(NodePool& other) noexcept {
+        if (this == &other || !other.slabs) return;
+
+        other.oldestSlab->previous = slabs;
+        slabs = other.slabs;
+        if (!oldestSlab)
+            oldestSlab = other.oldestSlab;
+
+        if (other.freeList) {
+            other.freeTail->next = freeList;
+            freeList = other.freeList;
+            if (!freeTail)
+                freeTail = other.freeTail;
+        }
+        for (Node* slot = other.cursor; slot != other.end; ++slot)
+            pushFree(slot);
+
+        slabCount += other.slabCount;
+        capacity += other.capacity;
+        used += other.used;
+        nextSlabNodes = std::max(nextSlabNodes, other.nextSlabNodes);
+        other.reset();
+    }
+
+    const NodeAllocator& getAllocator() const noexcept {
+        return allocator;
+    }
+
+    PoolStats getStats() const noexcept {
+        return PoolStats{slabCount, capacity, used};
+    }
+};
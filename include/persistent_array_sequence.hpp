@@ -0,0 +1,366 @@
+#pragma once
+
+#include "sequence.hpp"
+#include "errors.hpp"
+#include "dynamic_array.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+
+// Неизменяемая последовательность на персистентном векторе: 32-арное префиксное
+// дерево плюс хвостовой буфер на последние 32 элемента, как в Clojure/Scala.
+// Версии делят между собой все нетронутые узлы, поэтому append и удаление
+// последнего элемента почти O(1), get и set — O(log32 n), а старые версии
+// остаются действительными. Вставка и удаление в середине пересобирают вектор за O(n).
+// Узел меняется на месте, только если на него никто, кроме строящейся версии,
+// не ссылается; опубликованные версии не меняются никогда
+template <typename T>
+class PersistentArraySequence : public Sequence<T> {
+private:
+    static constexpr int BITS = 5;
+    static constexpr int WIDTH = 1 << BITS;
+    static constexpr int MASK = WIDTH - 1;
+
+    struct Node {};
+
+    struct Branch : Node {
+        std::shared_ptr<Node> children[WIDTH];
+    };
+
+    struct Leaf : Node {
+        DynamicArray<T> items;
+
+        Leaf() {
+            items.reserve(WIDTH);
+        }
+
+        Leaf(const Leaf& other) : Leaf() {
+            items.appendRange(other.items, 0, other.items.getSize());
+        }
+    };
+
+    // Дерево хранит элементы [0, tailOffset()), хвост — остальные
+    std::shared_ptr<Node> root;
+    std::shared_ptr<Node> tail;
+    int size;
+    int shift;
+
+    static const Leaf& asLeaf(const std::shared_ptr<Node>& node) {
+        return *static_cast<const Leaf*>(node.get());
+    }
+
+    static const Branch& asBranch(const std::shared_ptr<Node>& node) {
+        return *static_cast<const Branch*>(node.get());
+    }
+
+    // Узел, который можно менять: сам узел, если ссылка на него единственная, иначе копия
+    template <typename N>
+    static N* editable(std::shared_ptr<Node>& slot) {
+        if (slot.use_count() != 1)
+            slot = std::make_shared<N>(*static_cast<const N*>(slot.get()));
+        return static_cast<N*>(slot.get());
+    }
+
+    static std::shared_ptr<Node> newPath(int level, std::shared_ptr<Node> node) {
+        if (level == 0) return node;
+        auto branch = std::make_shared<Branch>();
+        branch->children[0] = newPath(level - BITS, std::move(node));
+        return branch;
+    }
+
+    int tailOffset() const {
+        return size < WIDTH ? 0 : ((size - 1) >> BITS) << BITS;
+    }
+
+    const std::shared_ptr<Node>& leafSlotFor(int index) const {
+        if (index >= tailOffset()) return tail;
+        const std::shared_ptr<Node>* slot = &root;
+        for (int level = shift; level > 0; level -= BITS)
+            slot = &asBranch(*slot).children[(index >> level) & MASK];
+        return *slot;
+    }
+
+    const T& at(int index) const {
+        return asLeaf(leafSlotFor(index)).items.unsafeGet(index & MASK);
+    }
+
+    // Вызывается при полном хвосте; size ещё не учитывает новый элемент
+    void pushTail(int level, std::shared_ptr<Node>& slot, std::shared_ptr<Node> leaf) {
+        Branch* node = editable<Branch>(slot);
+        std::shared_ptr<Node>& child = node->children[((size - 1) >> level) & MASK];
+        if (level == BITS)
+            child = std::move(leaf);
+        else if (child)
+            pushTail(level - BITS, child, std::move(leaf));
+        else
+            child = newPath(level - BITS, std::move(leaf));
+    }
+
+    void pushTailIntoTree() {
+        if (!root) {
+            root = newPath(BITS, std::move(tail));
+            shift = BITS;
+        } else if ((size >> BITS) > (1 << shift)) {
+            auto branch = std::make_shared<Branch>();
+            branch->children[0] = std::move(root);
+            branch->children[1] = newPath(shift, std::move(tail));
+            root = std::move(branch);
+            shift += BITS;
+        } else {
+            pushTail(shift, root, std::move(tail));
+        }
+    }
+
+    void pushBack(T item) {
+        if (size > 0 && size - tailOffset() < WIDTH) {
+            editable<Leaf>(tail)->items.pushBack(std::move(item));
+        } else {
+            auto leaf = std::make_shared<Leaf>();
+            leaf->items.pushBack(std::move(item));
+            if (size > 0)
+                pushTailIntoTree();
+            tail = std::move(leaf);
+        }
+        ++size;
+    }
+
+    // Отцепляет от дерева лист с элементом size - 2 и пустые узлы над ним
+    void popTail(int level, std::shared_ptr<Node>& slot) {
+        int subidx = ((size - 2) >> level) & MASK;
+        Branch* node = editable<Branch>(slot);
+        if (level > BITS)
+            popTail(level - BITS, node->children[subidx]);
+        else
+            node->children[subidx].reset();
+        if (subidx == 0 && !node->children[0])
+            slot.reset();
+    }
+
+    void popBack() {
+        if (size == 1) {
+            root.reset();
+            tail.reset();
+            size = 0;
+            shift = BITS;
+            return;
+        }
+        if (size - tailOffset() > 1) {
+            editable<Leaf>(tail)->items.popBack();
+            --size;
+            return;
+        }
+
+        std::shared_ptr<Node> newTail = leafSlotFor(size - 2);
+        popTail(shift, root);
+        if (!root) {
+            shift = BITS;
+        } else if (shift > BITS && !asBranch(root).children[1]) {
+            root = asBranch(root).children[0];
+            shift -= BITS;
+        }
+        tail = std::move(newTail);
+        --size;
+    }
+
+    void assign(int index, T item) {
+        if (index >= tailOffset()) {
+            editable<Leaf>(tail)->items.unsafeSet(index & MASK, std::move(item));
+            return;
+        }
+        std::shared_ptr<Node>* slot = &root;
+        for (int level = shift; level > 0; level -= BITS)
+            slot = &editable<Branch>(*slot)->children[(index >> level) & MASK];
+        editable<Leaf>(*slot)->items.unsafeSet(index & MASK, std::move(item));
+    }
+
+    // Обход по листам: поиск листа один раз на 32 элемента
+    template <typename F>
+    void forEachIn(int startIndex, int endIndex, F&& f) const {
+        int index = startIndex;
+        while (index < endIndex) {
+            const DynamicArray<T>& items = asLeaf(leafSlotFor(index)).items;
+            int last = std::min(endIndex, (index | MASK) + 1);
+            for (; index < last; ++index)
+                f(items.unsafeGet(index & MASK));
+        }
+    }
+
+    template <typename F>
+    void forEach(F&& f) const {
+        forEachIn(0, size, std::forward<F>(f));
+    }
+
+public:
+    PersistentArraySequence() : size(0), shift(BITS) {}
+
+    PersistentArraySequence(T* items, int count) : PersistentArraySequence() {
+        if (count < 0) throw Errors::negativeCount();
+        for (int i = 0; i < count; ++i)
+            pushBack(items[i]);
+    }
+
+    // Копия делит с оригиналом все узлы
+    PersistentArraySequence(const PersistentArraySequence& other) = default;
+
+    PersistentArraySequence(PersistentArraySequence&& other) noexcept
+        : root(std::move(other.root)), tail(std::move(other.tail)),
+          size(other.size), shift(other.shift) {
+        other.size = 0;
+        other.shift = BITS;
+    }
+
+    PersistentArraySequence& operator=(const PersistentArraySequence& other) = default;
+
+    PersistentArraySequence& operator=(PersistentArraySequence&& other) noexcept {
+        if (this != &other) {
+            root = std::move(other.root);
+            tail = std::move(other.tail);
+            size = other.size;
+            shift = other.shift;
+            other.size = 0;
+            other.shift = BITS;
+        }
+        return *this;
+    }
+
+    ~PersistentArraySequence() override = default;
+
+    T getFirst() const override {
+        if (size == 0) throw Errors::emptyArray();
+        return at(0);
+    }
+
+    T getLast() const override {
+        if (size == 0) throw Errors::emptyArray();
+        return at(size - 1);
+    }
+
+    T get(int index) const override {
+        if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+        return at(index);
+    }
+
+    int getLength() const override {
+        return size;
+    }
+
+    T& operator[](int) override {
+        throw Errors::immutable();
+    }
+
+    const T& operator[](int index) const override {
+        if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+        return at(index);
+    }
+
+    Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
+            throw Errors::invalidIndices();
+
+        auto result = std::make_unique<PersistentArraySequence>();
+        forEachIn(startIndex, endIndex + 1, [&result](const T& item) { result->pushBack(item); });
+        return result.release();
+    }
+
+    Sequence<T>* append(T item) override {
+        auto result = std::make_unique<PersistentArraySequence>(*this);
+        result->pushBack(std::move(item));
+        return result.release();
+    }
+
+    Sequence<T>* prepend(T item) override {
+        return insertAt(std::move(item), 0);
+    }
+
+    Sequence<T>* insertAt(T item, int index) override {
+        if (index < 0 || index > size) throw Errors::indexOutOfRange();
+        if (index == size) return append(std::move(item));
+
+        auto result = std::make_unique<PersistentArraySequence>();
+        auto push = [&result](const T& value) { result->pushBack(value); };
+        forEachIn(0, index, push);
+        result->pushBack(std::move(item));
+        forEachIn(index, size, push);
+        return result.release();
+    }
+
+    // Новая версия с заменённым элементом: копируется только путь до листа
+    Sequence<T>* set(int index, T item) const {
+        if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+        auto result = std::make_unique<PersistentArraySequence>(*this);
+        result->assign(index, std::move(item));
+        return result.release();
+    }
+
+    Sequence<T>* remove(int index) override {
+        if (size == 0) throw Errors::emptyArray();
+        if (index < 0 || index >= size) throw Errors::indexOutOfRange();
+
+        if (index == size - 1) {
+            auto result = std::make_unique<PersistentArraySequence>(*this);
+            result->popBack();
+            return result.release();
+        }
+        auto result = std::make_unique<PersistentArraySequence>();
+        auto push = [&result](const T& value) { result->pushBack(value); };
+        forEachIn(0, index, push);
+        forEachIn(index + 1, size, push);
+        return result.release();
+    }
+
+    // Левая часть не копируется, элементы other дописываются к ней
+    Sequence<T>* concat(const Sequence<T>* other) const override {
+        if (!other) throw Errors::invalidArgument();
+
+        auto result = std::make_unique<PersistentArraySequence>(*this);
+        if (const auto* persistent = dynamic_cast<const PersistentArraySequence*>(other)) {
+            persistent->forEach([&result](const T& item) { result->pushBack(item); });
+        } else {
+            for (int i = 0; i < other->getLength(); ++i)
+                result->pushBack(other->get(i));
+        }
+        return result.release();
+    }
+
+    Sequence<T>* clone() const override {
+        return new PersistentArraySequence(*this);
+    }
+
+    Sequence<T>* map(std::function<T(T)> f) const override {
+        auto result = std::make_unique<PersistentArraySequence>();
+        forEach([&](const T& item) { result->pushBack(f(item)); });
+        return result.release();
+    }
+
+    Sequence<T>* where(std::function<bool(T)> predicate) const override {
+        auto result = std::make_unique<PersistentArraySequence>();
+        forEach([&](const T& item) {
+            if (predicate(item))
+                result->pushBack(item);
+        });
+        return result.release();
+    }
+
+    T reduce(std::function<T(T, T)> reducer, T initial) const override {
+        T acc = initial;
+        forEach([&](const T& item) { acc = reducer(acc, item); });
+        return acc;
+    }
+
+    Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
+        int len = std::min(size, other->getLength());
+        auto result = std::make_unique<PersistentArraySequence>();
+        int index = 0;
+        forEachIn(0, len, [&](const T& item) { result->pushBack(combiner(item, other->get(index++))); });
+        return result.release();
+    }
+
+    Sequence<T>* slice(int start, int end) const override {
+        if (start < 0) start = 0;
+        if (end > size) end = size;
+        if (start >= end) return new PersistentArraySequence();
+        return getSubsequence(start, end - 1);
+    }
+};
@@ -6,55 +6,74 @@
 #include <stdexcept>
 #include <memory>
 
-template <typename T>
+template <typename T, typename List = LinkedList<T>>
 class Queue {
+public:
+    using Allocator = typename List::allocator_type;
+
 private:
-    MutableListSequence<T> sequence;
+    MutableListSequence<T, List> sequence;
 
-    static MutableListSequence<T> convertSequence(const Sequence<T>* seq) {
-        if (auto derived = dynamic_cast<const MutableListSequence<T>*>(seq)) {
+    static MutableListSequence<T, List> convertSequence(const Sequence<T>* seq, const Allocator& allocator) {
+        if (auto derived = dynamic_cast<const MutableListSequence<T, List>*>(seq)) {
             return *derived;
         }
         
-        MutableListSequence<T> result;
+        MutableListSequence<T, List> result{List(allocator)};
         for (int i = 0; i < seq->getLength(); ++i) {
             result.append(seq->get(i));
         }
         return result;
     }
 
+    static MutableListSequence<T, List> adoptSequence(Sequence<T>* seq, const Allocator& allocator) {
+        if (auto derived = dynamic_cast<MutableListSequence<T, List>*>(seq)) {
+            MutableListSequence<T, List> result(std::move(*derived));
+            delete seq;
+            return result;
+        }
+        MutableListSequence<T, List> result = convertSequence(seq, allocator);
+        delete seq;
+        return result;
+    }
+
 public:
     Queue() = default;
 
-    explicit Queue(const Sequence<T>* other) : sequence(convertSequence(other)) {}
+    explicit Queue(const Allocator& allocator) : sequence(List(allocator)) {}
 
-    explicit Queue(Sequence<T>*&& other) noexcept {
-        if (auto derived = dynamic_cast<MutableListSequence<T>*>(other)) {
-            sequence = std::move(*derived);
-            delete other;
-            other = nullptr;
-        } else {
-            sequence = convertSequence(other);
-            delete other;
-            other = nullptr;
-        }
+    explicit Queue(const Sequence<T>* other, const Allocator& allocator = Allocator())
+        : sequence(convertSequence(other, allocator)) {}
+
+    explicit Queue(Sequence<T>*&& other, const Allocator& allocator = Allocator()) noexcept
+        : sequence(adoptSequence(other, allocator)) {
+        other = nullptr;
     }
 
-    Queue(const Queue<T>& other) = default;
-    Queue(Queue<T>&& other) noexcept = default;
+    Queue(const Queue& other) = default;
+    Queue(Queue&& other) noexcept = default;
 
-    Queue<T>& operator=(const Queue<T>& other) = default;
-    Queue<T>& operator=(Queue<T>&& other) noexcept = default;
+    Queue& operator=(const Queue& other) = default;
+    Queue& operator=(Queue&& other) noexcept = default;
 
     void enqueue(const T& item) {
         sequence.append(item);
     }
+
+    void enqueue(T&& item) {
+        sequence.append(std::move(item));
+    }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        return sequence.emplaceBack(std::forward<Args>(args)...);
+    }
     
     T dequeue() {
         if (isEmpty()) {
             throw std::runtime_error("Queue is empty");
         }
-        T item = sequence.getFirst();
+        T item = std::move(sequence[0]);
         sequence.remove(0);
         return item;
     }
@@ -77,6 +96,10 @@ public:
         return sequence[0];
     }
 
+    Allocator getAllocator() const {
+        return sequence.getAllocator();
+    }
+
     int size() const {
         return sequence.getLength();
     }
@@ -91,28 +114,53 @@ public:
         }
     }
 
-    Queue<T> map(std::function<T(T)> f) const {
-        return Queue<T>(sequence.map(f));
+    Queue map(std::function<T(T)> f) const {
+        return Queue(sequence.map(f), getAllocator());
     }
 
-    Queue<T> where(std::function<bool(T)> predicate) const {
-        return Queue<T>(sequence.where(predicate));
+    Queue where(std::function<bool(T)> predicate) const {
+        return Queue(sequence.where(predicate), getAllocator());
     }
 
     T reduce(std::function<T(T, T)> reducer, T initial) const {
         return sequence.reduce(reducer, initial);
     }
 
-    Queue<T> concat(const Queue<T>& other) const {
+    Queue concat(const Queue& other) const {
         auto new_seq = sequence.clone();
         for (int i = 0; i < other.size(); ++i) {
             new_seq->append(other.sequence.get(i));
         }
-        return Queue<T>(new_seq);
+        return Queue(std::move(new_seq), getAllocator());
     }
 
-    Queue<T> getSubsequence(int startIndex, int endIndex) const {
-        return Queue<T>(sequence.getSubsequence(startIndex, endIndex));
+    // Элементы other переходят в конец без копирования, other остаётся пустым
+    void concatInPlace(Queue&& other) {
+        sequence.concatInPlace(std::move(other.sequence));
+    }
+
+    Queue concat(Queue&& other) const {
+        Queue result(*this);
+        result.concatInPlace(std::move(other));
+        return result;
+    }
+
+    template <typename ForwardIt>
+    void insertRange(int index, ForwardIt first, ForwardIt last) {
+        sequence.insertRange(index, first, last);
+    }
+
+    void removeRange(int startIndex, int endIndex) {
+        sequence.removeRange(startIndex, endIndex);
+    }
+
+    template <typename Predicate>
+    int removeIf(Predicate predicate) {
+        return sequence.removeIf(predicate);
+    }
+
+    Queue getSubsequence(int startIndex, int endIndex) const {
+        return Queue(sequence.getSubsequence(startIndex, endIndex), getAllocator());
     }
 
     bool contains(const T& item) const {
@@ -124,7 +172,7 @@ public:
         return false;
     }
 
-    bool containsSubsequence(const Queue<T>& sub) const {
+    bool containsSubsequence(const Queue& sub) const {
         if (sub.isEmpty()) return true;
         if (size() < sub.size()) return false;
 
@@ -141,6 +189,15 @@ public:
         return false;
     }
 
+    // Упорядочивает очередь от головы к хвосту; без компаратора по operator<
+    void sort(std::function<bool(const T&, const T&)> comparator = nullptr) {
+        if (comparator) {
+            sequence.sort(comparator);
+        } else {
+            sequence.sort();
+        }
+    }
+
     template <typename U>
     Queue<std::pair<T, U>> zip(const Queue<U>& other) const {
         Queue<std::pair<T, U>> result;
@@ -151,8 +208,8 @@ public:
         return result;
     }
 
-    std::pair<Queue<T>, Queue<T>> split(std::function<bool(T)> predicate) const {
-        Queue<T> left, right;
+    std::pair<Queue, Queue> split(std::function<bool(T)> predicate) const {
+        Queue left(getAllocator()), right(getAllocator());
         for (int i = 0; i < sequence.getLength(); ++i) {
             T item = sequence.get(i);
             if (predicate(item)) {
@@ -164,7 +221,7 @@ public:
         return {left, right};
     }
 
-    bool operator==(const Queue<T>& other) const {
+    bool operator==(const Queue& other) const {
         if (size() != other.size()) return false;
         for (int i = 0; i < size(); ++i) {
             if (sequence.get(i) != other.sequence.get(i)) {
@@ -174,7 +231,7 @@ public:
         return true;
     }
 
-    bool operator!=(const Queue<T>& other) const {
+    bool operator!=(const Queue& other) const {
         return !(*this == other);
     }
 };
\ No newline at end of file
@@ -0,0 +1,445 @@
+#pragma once
+
+#include "sequence.hpp"
+#include "errors.hpp"
+#include "dynamic_array.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+// Верёвка: AVL-сбалансированное дерево с листами до LEAF_CAPACITY элементов.
+// Размер поддерева хранится в узле, поэтому get, insertAt, remove, getSubsequence
+// и concat работают за O(log n) через split и join.
+// Узлы делятся между копиями: clone, concat и getSubsequence не копируют дерево,
+// а запись через operator[] копирует путь до листа, только если он с кем-то разделён.
+// Перед деревом и после него лежат буферы head (в обратном порядке) и tail,
+// так что append, prepend и доступ к концам стоят O(1) амортизированно
+template <typename T>
+class RopeSequence : public Sequence<T> {
+private:
+    static constexpr int LEAF_CAPACITY = 64;
+
+    struct Node;
+    using NodePtr = std::shared_ptr<Node>;
+
+    // Лист хранит элементы в items, у ветви есть оба потомка
+    struct Node {
+        NodePtr left;
+        NodePtr right;
+        DynamicArray<T> items;
+        int size;
+        int height;
+
+        bool isLeaf() const { return !left; }
+    };
+
+    NodePtr root;
+    DynamicArray<T> head;
+    DynamicArray<T> tail;
+
+    // Крайние листы дерева для getFirst и getLast за O(1)
+    const Node* firstLeaf;
+    const Node* lastLeaf;
+
+    static int sizeOf(const NodePtr& node) {
+        return node ? node->size : 0;
+    }
+
+    static int heightOf(const NodePtr& node) {
+        return node ? node->height : 0;
+    }
+
+    static NodePtr leafOf(DynamicArray<T>&& items) {
+        if (items.getSize() == 0) return nullptr;
+        auto node = std::make_shared<Node>();
+        node->items = std::move(items);
+        node->size = node->items.getSize();
+        node->height = 1;
+        return node;
+    }
+
+    static NodePtr leafOf(const T* first, const T* last) {
+        DynamicArray<T> items;
+        items.reserve(static_cast<int>(last - first));
+        items.insertRange(0, first, last);
+        return leafOf(std::move(items));
+    }
+
+    static NodePtr branch(NodePtr left, NodePtr right) {
+        auto node = std::make_shared<Node>();
+        node->size = left->size + right->size;
+        node->height = std::max(left->height, right->height) + 1;
+        node->left = std::move(left);
+        node->right = std::move(right);
+        return node;
+    }
+
+    // Склеивает поддеревья, высоты которых различаются не больше чем на 2
+    static NodePtr balance(NodePtr left, NodePtr right) {
+        if (left->height > right->height + 1) {
+            if (heightOf(left->left) < heightOf(left->right))
+                left = branch(branch(left->left, left->right->left), left->right->right);
+            return branch(left->left, branch(left->right, std::move(right)));
+        }
+        if (right->height > left->height + 1) {
+            if (heightOf(right->right) < heightOf(right->left))
+                right = branch(right->left->left, branch(right->left->right, right->right));
+            return branch(branch(std::move(left), right->left), right->right);
+        }
+        return branch(std::move(left), std::move(right));
+    }
+
+    // Конкатенация за O(|высота a - высота b|); соседние маленькие листья сливаются
+    static NodePtr join(const NodePtr& a, const NodePtr& b) {
+        if (!a) return b;
+        if (!b) return a;
+        if (a->isLeaf() && b->isLeaf() && a->size + b->size <= LEAF_CAPACITY) {
+            DynamicArray<T> items;
+            items.reserve(a->size + b->size);
+            items.appendRange(a->items, 0, a->size);
+            items.appendRange(b->items, 0, b->size);
+            return leafOf(std::move(items));
+        }
+        if (a->height > b->height + 1)
+            return balance(a->left, join(a->right, b));
+        if (b->height > a->height + 1)
+            return balance(join(a, b->left), b->right);
+        return branch(a, b);
+    }
+
+    // Делит дерево на первые count элементов и остальные
+    static std::pair<NodePtr, NodePtr> split(const NodePtr& node, int count) {
+        if (count <= 0) return {nullptr, node};
+        if (count >= sizeOf(node)) return {node, nullptr};
+        if (node->isLeaf()) {
+            const T* items = node->items.data();
+            return {leafOf(items, items + count), leafOf(items + count, items + node->size)};
+        }
+        if (count <= node->left->size) {
+            auto parts = split(node->left, count);
+            return {std::move(parts.first), join(parts.second, node->right)};
+        }
+        auto parts = split(node->right, count - node->left->size);
+        return {join(node->left, parts.first), std::move(parts.second)};
+    }
+
+    // Узел, который можно менять: сам узел, если ссылка на него единственная, иначе копия
+    static Node* editable(NodePtr& slot) {
+        if (slot.use_count() != 1)
+            slot = std::make_shared<Node>(*slot);
+        return slot.get();
+    }
+
+    template <typename F>
+    static void forEachIn(const Node* node, F& f) {
+        if (!node) return;
+        if (node->isLeaf()) {
+            for (const T& item : node->items)
+                f(item);
+            return;
+        }
+        forEachIn(node->left.get(), f);
+        forEachIn(node->right.get(), f);
+    }
+
+    void setRoot(NodePtr node) {
+        root = std::move(node);
+        firstLeaf = lastLeaf = root.get();
+        while (firstLeaf && !firstLeaf->isLeaf())
+            firstLeaf = firstLeaf->left.get();
+        while (lastLeaf && !lastLeaf->isLeaf())
+            lastLeaf = lastLeaf->right.get();
+    }
+
+    NodePtr headLeaf() const {
+        DynamicArray<T> items;
+        items.reserve(head.getSize());
+        for (int i = head.getSize() - 1; i >= 0; --i)
+            items.pushBack(head.unsafeGet(i));
+        return leafOf(std::move(items));
+    }
+
+    // Вся последовательность одним деревом, буферы копируются в крайние листы
+    NodePtr wholeTree() const {
+        NodePtr tree = join(headLeaf(), root);
+        if (tail.getSize() > 0)
+            tree = join(tree, leafOf(tail.data(), tail.data() + tail.getSize()));
+        return tree;
+    }
+
+    void flush() {
+        NodePtr tree = wholeTree();
+        head.clear();
+        tail.clear();
+        setRoot(std::move(tree));
+    }
+
+    const T& at(int index) const {
+        int headSize = head.getSize();
+        if (index < headSize) return head.unsafeGet(headSize - 1 - index);
+        index -= headSize;
+        if (index >= sizeOf(root)) return tail.unsafeGet(index - sizeOf(root));
+
+        const Node* node = root.get();
+        while (!node->isLeaf()) {
+            if (index < node->left->size) {
+                node = node->left.get();
+            } else {
+                index -= node->left->size;
+                node = node->right.get();
+            }
+        }
+        return node->items.unsafeGet(index);
+    }
+
+    T& mutableAt(int index) {
+        int headSize = head.getSize();
+        if (index < headSize) return head[headSize - 1 - index];
+        index -= headSize;
+        if (index >= sizeOf(root)) return tail[index - sizeOf(root)];
+
+        NodePtr* slot = &root;
+        Node* node = editable(*slot);
+        while (!node->isLeaf()) {
+            if (index < node->left->size) {
+                slot = &node->left;
+            } else {
+                index -= node->left->size;
+                slot = &node->right;
+            }
+            node = editable(*slot);
+        }
+        setRoot(std::move(root));
+        return node->items[index];
+    }
+
+    template <typename F>
+    void forEach(F&& f) const {
+        for (int i = head.getSize() - 1; i >= 0; --i)
+            f(head.unsafeGet(i));
+        forEachIn(root.get(), f);
+        for (const T& item : tail)
+            f(item);
+    }
+
+    void checkIndex(int index) const {
+        if (index < 0 || index >= getLength())
+            throw Errors::indexOutOfRange("Index: " + std::to_string(index));
+    }
+
+public:
+    RopeSequence() : firstLeaf(nullptr), lastLeaf(nullptr) {}
+
+    RopeSequence(T* items, int count) : RopeSequence() {
+        if (count < 0) throw Errors::negativeCount();
+        NodePtr tree;
+        for (int start = 0; start < count; start += LEAF_CAPACITY)
+            tree = join(tree, leafOf(items + start, items + std::min(count, start + LEAF_CAPACITY)));
+        setRoot(std::move(tree));
+    }
+
+    // Копия делит с оригиналом дерево, копируются только буферы на концах
+    RopeSequence(const RopeSequence& other)
+        : root(other.root), head(other.head), tail(other.tail),
+          firstLeaf(other.firstLeaf), lastLeaf(other.lastLeaf) {}
+
+    RopeSequence(RopeSequence&& other) noexcept
+        : root(std::move(other.root)), head(std::move(other.head)), tail(std::move(other.tail)),
+          firstLeaf(other.firstLeaf), lastLeaf(other.lastLeaf) {
+        other.firstLeaf = other.lastLeaf = nullptr;
+    }
+
+    RopeSequence& operator=(const RopeSequence& other) {
+        if (this != &other) {
+            RopeSequence copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    RopeSequence& operator=(RopeSequence&& other) noexcept {
+        if (this != &other) {
+            root = std::move(other.root);
+            head = std::move(other.head);
+            tail = std::move(other.tail);
+            firstLeaf = other.firstLeaf;
+            lastLeaf = other.lastLeaf;
+            other.firstLeaf = other.lastLeaf = nullptr;
+        }
+        return *this;
+    }
+
+    ~RopeSequence() override = default;
+
+    T getFirst() const override {
+        if (head.getSize() > 0) return head.unsafeGet(head.getSize() - 1);
+        if (firstLeaf) return firstLeaf->items.unsafeGet(0);
+        if (tail.getSize() > 0) return tail.unsafeGet(0);
+        throw Errors::emptyArray();
+    }
+
+    T getLast() const override {
+        if (tail.getSize() > 0) return tail.unsafeGet(tail.getSize() - 1);
+        if (lastLeaf) return lastLeaf->items.unsafeGet(lastLeaf->size - 1);
+        if (head.getSize() > 0) return head.unsafeGet(0);
+        throw Errors::emptyArray();
+    }
+
+    T get(int index) const override {
+        checkIndex(index);
+        return at(index);
+    }
+
+    int getLength() const override {
+        return head.getSize() + sizeOf(root) + tail.getSize();
+    }
+
+    T& operator[](int index) override {
+        if (index < 0 || index >= getLength())
+            throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+        return mutableAt(index);
+    }
+
+    const T& operator[](int index) const override {
+        if (index < 0 || index >= getLength())
+            throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+        return at(index);
+    }
+
+    Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0 || endIndex >= getLength() || startIndex > endIndex)
+            throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                         ", End: " + std::to_string(endIndex));
+
+        auto rest = split(wholeTree(), startIndex).second;
+        auto result = std::make_unique<RopeSequence>();
+        result->setRoot(split(rest, endIndex - startIndex + 1).first);
+        return result.release();
+    }
+
+    Sequence<T>* append(T item) override {
+        tail.pushBack(std::move(item));
+        if (tail.getSize() == LEAF_CAPACITY) {
+            NodePtr tree = join(root, leafOf(std::move(tail)));
+            tail = DynamicArray<T>();
+            setRoot(std::move(tree));
+        }
+        return this;
+    }
+
+    Sequence<T>* prepend(T item) override {
+        head.pushBack(std::move(item));
+        if (head.getSize() == LEAF_CAPACITY) {
+            NodePtr tree = join(headLeaf(), root);
+            head.clear();
+            setRoot(std::move(tree));
+        }
+        return this;
+    }
+
+    Sequence<T>* insertAt(T item, int index) override {
+        if (index < 0 || index > getLength())
+            throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+
+        int headSize = head.getSize();
+        int treeEnd = headSize + sizeOf(root);
+        if (index == getLength()) return append(std::move(item));
+        if (index == 0) return prepend(std::move(item));
+        if (index <= headSize && headSize < LEAF_CAPACITY) {
+            head.insertAt(headSize - index, std::move(item));
+        } else if (index >= treeEnd && tail.getSize() < LEAF_CAPACITY) {
+            tail.insertAt(index - treeEnd, std::move(item));
+        } else {
+            if (index < headSize || index > treeEnd) {
+                flush();
+                headSize = 0;
+            }
+            auto parts = split(root, index - headSize);
+            DynamicArray<T> single;
+            single.pushBack(std::move(item));
+            setRoot(join(join(parts.first, leafOf(std::move(single))), parts.second));
+        }
+        return this;
+    }
+
+    Sequence<T>* remove(int index) override {
+        if (getLength() == 0) throw Errors::emptyArray();
+        if (index < 0 || index >= getLength())
+            throw Errors::indexOutOfRange("Remove index: " + std::to_string(index));
+
+        int headSize = head.getSize();
+        int treeEnd = headSize + sizeOf(root);
+        if (index < headSize) {
+            head.remove(headSize - 1 - index);
+        } else if (index >= treeEnd) {
+            tail.remove(index - treeEnd);
+        } else {
+            auto parts = split(root, index - headSize);
+            setRoot(join(parts.first, split(parts.second, 1).second));
+        }
+        return this;
+    }
+
+    // С другой верёвкой склеивается за O(log n), остальные последовательности дописываются поэлементно
+    Sequence<T>* concat(const Sequence<T>* other) const override {
+        if (!other) throw Errors::invalidArgument();
+
+        if (const auto* rope = dynamic_cast<const RopeSequence*>(other)) {
+            auto result = std::make_unique<RopeSequence>();
+            result->setRoot(join(wholeTree(), rope->wholeTree()));
+            return result.release();
+        }
+        auto result = std::make_unique<RopeSequence>(*this);
+        for (int i = 0; i < other->getLength(); ++i)
+            result->append(other->get(i));
+        return result.release();
+    }
+
+    Sequence<T>* clone() const override {
+        return new RopeSequence(*this);
+    }
+
+    Sequence<T>* map(std::function<T(T)> f) const override {
+        auto result = std::make_unique<RopeSequence>();
+        forEach([&](const T& item) { result->append(f(item)); });
+        return result.release();
+    }
+
+    Sequence<T>* where(std::function<bool(T)> predicate) const override {
+        auto result = std::make_unique<RopeSequence>();
+        forEach([&](const T& item) {
+            if (predicate(item))
+                result->append(item);
+        });
+        return result.release();
+    }
+
+    T reduce(std::function<T(T, T)> reducer, T initial) const override {
+        T acc = initial;
+        forEach([&](const T& item) { acc = reducer(acc, item); });
+        return acc;
+    }
+
+    Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
+        int len = std::min(getLength(), other->getLength());
+        auto result = std::make_unique<RopeSequence>();
+        int index = 0;
+        forEach([&](const T& item) {
+            if (index < len) {
+                result->append(combiner(item, other->get(index)));
+                ++index;
+            }
+        });
+        return result.release();
+    }
+
+    Sequence<T>* slice(int start, int end) const override {
+        if (start < 0) start = 0;
+        if (end > getLength()) end = getLength();
+        if (start >= end) return new RopeSequence();
+        return getSubsequence(start, end - 1);
+    }
+};
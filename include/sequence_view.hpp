@@ -0,0 +1,194 @@
+#pragma once
+
+#include "sequence.hpp"
+#include "errors.hpp"
+#include "dynamic_array.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+
+// Окно (буфер, смещение, длина) над непрерывными элементами другой последовательности.
+// Создание вида, getSubsequence, slice и clone стоят O(1) и ничего не копируют.
+// Вид неизменяем, как ImmutableArraySequence: append, insertAt, remove, concat
+// и map возвращают новый вид над собственной копией элементов.
+// Владеющий вид держит буфер через owner и остаётся действительным сколько угодно.
+// Невладеющий (owner пуст) действителен, пока источник жив и не меняет размер:
+// append, insertAt, remove, reserve, shrinkToFit и перемещение источника
+// инвалидируют его, а присваивание элементам через operator[] видно через вид.
+// Allocator — аллокатор хранилища источника: новые виды держат DynamicArray<T, Allocator>
+// с копией этого аллокатора, так что производные последовательности остаются в той же памяти
+template <typename T, typename Allocator = std::allocator<T>>
+class SequenceView : public Sequence<T> {
+private:
+    using Buffer = DynamicArray<T, Allocator>;
+
+    std::shared_ptr<const void> owner;
+    const T* items;
+    int length;
+    Allocator allocator;
+
+    static SequenceView* owning(Buffer&& array) {
+        Allocator bufferAllocator = array.getAllocator();
+        std::shared_ptr<const Buffer> buffer = std::allocate_shared<Buffer>(bufferAllocator, std::move(array));
+        const T* begin = buffer->data();
+        int count = buffer->getSize();
+        return new SequenceView(std::move(buffer), begin, count, bufferAllocator);
+    }
+
+    // Копия первых copyLength элементов с местом под capacity
+    Buffer copyWithCapacity(int capacity, int copyLength) const {
+        Buffer array(allocator);
+        array.reserve(capacity);
+        array.insertRange(0, items, items + copyLength);
+        return array;
+    }
+
+public:
+    SequenceView() : SequenceView(Allocator()) {}
+
+    explicit SequenceView(const Allocator& allocator)
+        : items(nullptr), length(0), allocator(allocator) {}
+
+    SequenceView(const T* items, int length, const Allocator& allocator = Allocator())
+        : SequenceView(nullptr, items, length, allocator) {}
+
+    SequenceView(std::shared_ptr<const void> owner, const T* items, int length,
+                 const Allocator& allocator = Allocator())
+        : owner(std::move(owner)), items(items), length(length), allocator(allocator) {
+        if (length < 0) throw Errors::negativeCount();
+    }
+
+    SequenceView(const SequenceView& other) = default;
+    SequenceView& operator=(const SequenceView& other) = default;
+
+    ~SequenceView() override = default;
+
+    T getFirst() const override {
+        if (length == 0) throw Errors::emptyArray();
+        return items[0];
+    }
+
+    T getLast() const override {
+        if (length == 0) throw Errors::emptyArray();
+        return items[length - 1];
+    }
+
+    T get(int index) const override {
+        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
+        return items[index];
+    }
+
+    int getLength() const override {
+        return length;
+    }
+
+    bool isOwning() const {
+        return owner != nullptr;
+    }
+
+    Allocator getAllocator() const {
+        return allocator;
+    }
+
+    T& operator[](int) override {
+        throw Errors::immutable();
+    }
+
+    const T& operator[](int index) const override {
+        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
+        return items[index];
+    }
+
+    const T* data() const {
+        return items;
+    }
+
+    Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0 || endIndex >= length || startIndex > endIndex)
+            throw Errors::invalidIndices();
+        return new SequenceView(owner, items + startIndex, endIndex - startIndex + 1, allocator);
+    }
+
+    Sequence<T>* append(T item) override {
+        Buffer array = copyWithCapacity(length + 1, length);
+        array.pushBack(std::move(item));
+        return owning(std::move(array));
+    }
+
+    Sequence<T>* prepend(T item) override {
+        return insertAt(std::move(item), 0);
+    }
+
+    Sequence<T>* insertAt(T item, int index) override {
+        if (index < 0 || index > length) throw Errors::indexOutOfRange();
+
+        Buffer array = copyWithCapacity(length + 1, index);
+        array.pushBack(std::move(item));
+        array.insertRange(index + 1, items + index, items + length);
+        return owning(std::move(array));
+    }
+
+    Sequence<T>* remove(int index) override {
+        if (length == 0) throw Errors::emptyArray();
+        if (index < 0 || index >= length) throw Errors::indexOutOfRange();
+
+        Buffer array = copyWithCapacity(length - 1, index);
+        array.insertRange(index, items + index + 1, items + length);
+        return owning(std::move(array));
+    }
+
+    Sequence<T>* concat(const Sequence<T>* other) const override {
+        if (!other) throw Errors::invalidArgument();
+
+        Buffer array = copyWithCapacity(length + other->getLength(), length);
+        for (int i = 0; i < other->getLength(); ++i)
+            array.pushBack(other->get(i));
+        return owning(std::move(array));
+    }
+
+    Sequence<T>* clone() const override {
+        return new SequenceView(*this);
+    }
+
+    Sequence<T>* map(std::function<T(T)> f) const override {
+        Buffer mapped(allocator);
+        mapped.reserve(length);
+        for (int i = 0; i < length; ++i)
+            mapped.pushBack(f(items[i]));
+        return owning(std::move(mapped));
+    }
+
+    Sequence<T>* where(std::function<bool(T)> predicate) const override {
+        Buffer filtered(allocator);
+        for (int i = 0; i < length; ++i)
+            if (predicate(items[i]))
+                filtered.pushBack(items[i]);
+        filtered.shrinkToFit();
+        return owning(std::move(filtered));
+    }
+
+    T reduce(std::function<T(T, T)> reducer, T initial) const override {
+        T acc = initial;
+        for (int i = 0; i < length; ++i)
+            acc = reducer(acc, items[i]);
+        return acc;
+    }
+
+    Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
+        int len = std::min(length, other->getLength());
+        Buffer result(allocator);
+        result.reserve(len);
+        for (int i = 0; i < len; ++i)
+            result.pushBack(combiner(items[i], other->get(i)));
+        return owning(std::move(result));
+    }
+
+    Sequence<T>* slice(int start, int end) const override {
+        if (start < 0) start = 0;
+        if (end > length) end = length;
+        if (start >= end) return new SequenceView(allocator);
+        return getSubsequence(start, end - 1);
+    }
+};
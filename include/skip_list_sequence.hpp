@@ -0,0 +1,359 @@
+#pragma once
+
+#include "sequence.hpp"
+#include "errors.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+
+// Индексируемый скип-лист: каждая ссылка помнит, на сколько позиций она
+// перепрыгивает, поэтому get, insertAt и remove по индексу работают
+// за O(log n) в среднем. Узлы разной высоты, так что NodePool здесь
+// не подходит: каждый узел выделяется отдельно вместе со своими ссылками
+template <typename T>
+class SkipListSequence : public Sequence<T> {
+private:
+    static constexpr int MAX_LEVEL = 32;
+
+    struct Node;
+
+    struct Link {
+        Node* next;
+        int width;
+    };
+
+    // Ссылки лежат сразу за узлом в том же блоке памяти
+    struct alignas(T) alignas(Link) Node {
+        T data;
+        int height;
+
+        template <typename... Args>
+        explicit Node(int nodeHeight, Args&&... args)
+            : data(std::forward<Args>(args)...), height(nodeHeight) {}
+
+        Link* links() { return reinterpret_cast<Link*>(this + 1); }
+        const Link* links() const { return reinterpret_cast<const Link*>(this + 1); }
+    };
+
+    // Голова стоит на позиции 0, элементы занимают позиции 1..size,
+    // а у ссылок в никуда ширина считается до позиции size + 1
+    Link head[MAX_LEVEL];
+    int level;
+    int size;
+    std::minstd_rand random;
+
+    int randomHeight() {
+        int height = 1;
+        while (height < MAX_LEVEL && random() % 4 == 0)
+            ++height;
+        return height;
+    }
+
+    template <typename... Args>
+    static Node* createNode(int height, Args&&... args) {
+        void* memory = ::operator new(sizeof(Node) + sizeof(Link) * height,
+                                      std::align_val_t(alignof(Node)));
+        try {
+            return ::new (memory) Node(height, std::forward<Args>(args)...);
+        } catch (...) {
+            ::operator delete(memory, std::align_val_t(alignof(Node)));
+            throw;
+        }
+    }
+
+    static void destroyNode(Node* node) {
+        node->~Node();
+        ::operator delete(static_cast<void*>(node), std::align_val_t(alignof(Node)));
+    }
+
+    Link* linksOf(Node* node) {
+        return node ? node->links() : head;
+    }
+
+    // Узел на позиции position (1..size)
+    Node* nodeAt(int position) const {
+        const Link* links = head;
+        Node* current = nullptr;
+        int reached = 0;
+        for (int lvl = level - 1; lvl >= 0; --lvl) {
+            while (links[lvl].next && reached + links[lvl].width <= position) {
+                reached += links[lvl].width;
+                current = links[lvl].next;
+                links = current->links();
+            }
+        }
+        return current;
+    }
+
+    // Для каждого уровня находит последний узел левее позиции position
+    // и его позицию; nullptr обозначает голову
+    void findPredecessors(int position, Node** predecessors, int* ranks) {
+        Node* current = nullptr;
+        int reached = 0;
+        for (int lvl = level - 1; lvl >= 0; --lvl) {
+            Link* links = linksOf(current);
+            while (links[lvl].next && reached + links[lvl].width < position) {
+                reached += links[lvl].width;
+                current = links[lvl].next;
+                links = current->links();
+            }
+            predecessors[lvl] = current;
+            ranks[lvl] = reached;
+        }
+    }
+
+    template <typename... Args>
+    T& emplaceAt(int index, Args&&... args) {
+        int position = index + 1;
+        Node* predecessors[MAX_LEVEL];
+        int ranks[MAX_LEVEL];
+        findPredecessors(position, predecessors, ranks);
+
+        int height = randomHeight();
+        Node* node = createNode(height, std::forward<Args>(args)...);
+        for (; level < height; ++level) {
+            head[level] = Link{nullptr, size + 1};
+            predecessors[level] = nullptr;
+            ranks[level] = 0;
+        }
+
+        Link* links = node->links();
+        for (int lvl = 0; lvl < level; ++lvl) {
+            Link& incoming = linksOf(predecessors[lvl])[lvl];
+            if (lvl < height) {
+                links[lvl].next = incoming.next;
+                links[lvl].width = ranks[lvl] + incoming.width + 1 - position;
+                incoming.next = node;
+                incoming.width = position - ranks[lvl];
+            } else {
+                ++incoming.width;
+            }
+        }
+        ++size;
+        return node->data;
+    }
+
+    void eraseAt(int index) {
+        int position = index + 1;
+        Node* predecessors[MAX_LEVEL];
+        int ranks[MAX_LEVEL];
+        findPredecessors(position, predecessors, ranks);
+
+        Node* target = linksOf(predecessors[0])[0].next;
+        for (int lvl = 0; lvl < level; ++lvl) {
+            Link& incoming = linksOf(predecessors[lvl])[lvl];
+            if (incoming.next == target) {
+                incoming.width += target->links()[lvl].width - 1;
+                incoming.next = target->links()[lvl].next;
+            } else {
+                --incoming.width;
+            }
+        }
+        while (level > 1 && !head[level - 1].next)
+            --level;
+        --size;
+        destroyNode(target);
+    }
+
+    void reset() {
+        head[0] = Link{nullptr, 1};
+        level = 1;
+        size = 0;
+    }
+
+    template <typename F>
+    void forEach(F&& f) const {
+        for (const Node* current = head[0].next; current; current = current->links()[0].next)
+            f(current->data);
+    }
+
+public:
+    SkipListSequence() : level(1), size(0) {
+        head[0] = Link{nullptr, 1};
+    }
+
+    SkipListSequence(T* items, int count) : SkipListSequence() {
+        if (count < 0) throw Errors::negativeCount();
+        for (int i = 0; i < count; ++i)
+            append(items[i]);
+    }
+
+    SkipListSequence(const SkipListSequence& other) : SkipListSequence() {
+        other.forEach([this](const T& item) { emplaceBack(item); });
+    }
+
+    SkipListSequence(SkipListSequence&& other) noexcept
+        : level(other.level), size(other.size), random(other.random) {
+        std::copy(other.head, other.head + level, head);
+        other.reset();
+    }
+
+    SkipListSequence& operator=(const SkipListSequence& other) {
+        if (this != &other) {
+            SkipListSequence copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    SkipListSequence& operator=(SkipListSequence&& other) noexcept {
+        if (this != &other) {
+            clear();
+            level = other.level;
+            size = other.size;
+            random = other.random;
+            std::copy(other.head, other.head + level, head);
+            other.reset();
+        }
+        return *this;
+    }
+
+    ~SkipListSequence() override {
+        clear();
+    }
+
+    void clear() {
+        Node* current = head[0].next;
+        while (current) {
+            Node* next = current->links()[0].next;
+            destroyNode(current);
+            current = next;
+        }
+        reset();
+    }
+
+    T getFirst() const override {
+        if (size == 0) throw Errors::emptyList();
+        return head[0].next->data;
+    }
+
+    T getLast() const override {
+        if (size == 0) throw Errors::emptyList();
+        return nodeAt(size)->data;
+    }
+
+    T get(int index) const override {
+        if (index < 0 || index >= size)
+            throw Errors::indexOutOfRange("Index: " + std::to_string(index));
+        return nodeAt(index + 1)->data;
+    }
+
+    T& operator[](int index) override {
+        if (index < 0 || index >= size)
+            throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+        return nodeAt(index + 1)->data;
+    }
+
+    const T& operator[](int index) const override {
+        if (index < 0 || index >= size)
+            throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+        return nodeAt(index + 1)->data;
+    }
+
+    int getLength() const override {
+        return size;
+    }
+
+    Sequence<T>* getSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
+            throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                         ", End: " + std::to_string(endIndex));
+
+        auto result = std::make_unique<SkipListSequence>();
+        const Node* current = nodeAt(startIndex + 1);
+        for (int i = startIndex; i <= endIndex; ++i, current = current->links()[0].next)
+            result->emplaceBack(current->data);
+        return result.release();
+    }
+
+    Sequence<T>* append(T item) override {
+        emplaceAt(size, std::move(item));
+        return this;
+    }
+
+    Sequence<T>* prepend(T item) override {
+        emplaceAt(0, std::move(item));
+        return this;
+    }
+
+    Sequence<T>* insertAt(T item, int index) override {
+        if (index < 0 || index > size)
+            throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+        emplaceAt(index, std::move(item));
+        return this;
+    }
+
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {
+        return emplaceAt(size, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        return emplaceAt(0, std::forward<Args>(args)...);
+    }
+
+    Sequence<T>* remove(int index) override {
+        if (size == 0) throw Errors::emptyList();
+        if (index < 0 || index >= size)
+            throw Errors::indexOutOfRange("Remove index: " + std::to_string(index));
+        eraseAt(index);
+        return this;
+    }
+
+    Sequence<T>* concat(const Sequence<T>* other) const override {
+        if (!other) throw Errors::invalidArgument();
+
+        auto result = std::make_unique<SkipListSequence>(*this);
+        for (int i = 0; i < other->getLength(); ++i)
+            result->emplaceBack(other->get(i));
+        return result.release();
+    }
+
+    Sequence<T>* clone() const override {
+        return new SkipListSequence(*this);
+    }
+
+    Sequence<T>* map(std::function<T(T)> f) const override {
+        auto result = std::make_unique<SkipListSequence>();
+        forEach([&](const T& item) { result->emplaceBack(f(item)); });
+        return result.release();
+    }
+
+    Sequence<T>* where(std::function<bool(T)> predicate) const override {
+        auto result = std::make_unique<SkipListSequence>();
+        forEach([&](const T& item) {
+            if (predicate(item))
+                result->emplaceBack(item);
+        });
+        return result.release();
+    }
+
+    T reduce(std::function<T(T, T)> reducer, T initial) const override {
+        T acc = initial;
+        forEach([&](const T& item) { acc = reducer(acc, item); });
+        return acc;
+    }
+
+    Sequence<T>* zip(const Sequence<T>* other, std::function<T(T, T)> combiner) const override {
+        int len = std::min(size, other->getLength());
+        auto result = std::make_unique<SkipListSequence>();
+        const Node* current = head[0].next;
+        for (int i = 0; i < len; ++i, current = current->links()[0].next)
+            result->emplaceBack(combiner(current->data, other->get(i)));
+        return result.release();
+    }
+
+    Sequence<T>* slice(int start, int end) const override {
+        if (start < 0) start = 0;
+        if (end > size) end = size;
+        if (start >= end) return new SkipListSequence();
+        return getSubsequence(start, end - 1);
+    }
+};
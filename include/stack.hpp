@@ -6,55 +6,74 @@
 #include <stdexcept>
 #include <memory>
 
-template <typename T>
+template <typename T, typename List = LinkedList<T>>
 class Stack {
+public:
+    using Allocator = typename List::allocator_type;
+
 private:
-    MutableListSequence<T> sequence;
+    MutableListSequence<T, List> sequence;
 
-    static MutableListSequence<T> convertSequence(const Sequence<T>* seq) {
-        if (auto derived = dynamic_cast<const MutableListSequence<T>*>(seq)) {
+    static MutableListSequence<T, List> convertSequence(const Sequence<T>* seq, const Allocator& allocator) {
+        if (auto derived = dynamic_cast<const MutableListSequence<T, List>*>(seq)) {
             return *derived;
         }
         
-        MutableListSequence<T> result;
+        MutableListSequence<T, List> result{List(allocator)};
         for (int i = 0; i < seq->getLength(); ++i) {
             result.append(seq->get(i));
         }
         return result;
     }
 
+    static MutableListSequence<T, List> adoptSequence(Sequence<T>* seq, const Allocator& allocator) {
+        if (auto derived = dynamic_cast<MutableListSequence<T, List>*>(seq)) {
+            MutableListSequence<T, List> result(std::move(*derived));
+            delete seq;
+            return result;
+        }
+        MutableListSequence<T, List> result = convertSequence(seq, allocator);
+        delete seq;
+        return result;
+    }
+
 public:
     Stack() = default;
 
-    explicit Stack(const Sequence<T>* other) : sequence(convertSequence(other)) {}
+    explicit Stack(const Allocator& allocator) : sequence(List(allocator)) {}
 
-    explicit Stack(Sequence<T>*&& other) noexcept {
-        if (auto derived = dynamic_cast<MutableListSequence<T>*>(other)) {
-            sequence = std::move(*derived);
-            delete other;
-            other = nullptr;
-        } else {
-            sequence = convertSequence(other);
-            delete other;
-            other = nullptr;
-        }
+    explicit Stack(const Sequence<T>* other, const Allocator& allocator = Allocator())
+        : sequence(convertSequence(other, allocator)) {}
+
+    explicit Stack(Sequence<T>*&& other, const Allocator& allocator = Allocator()) noexcept
+        : sequence(adoptSequence(other, allocator)) {
+        other = nullptr;
     }
 
-    Stack(const Stack<T>& other) = default;
-    Stack(Stack<T>&& other) noexcept = default;
+    Stack(const Stack& other) = default;
+    Stack(Stack&& other) noexcept = default;
 
-    Stack<T>& operator=(const Stack<T>& other) = default;
-    Stack<T>& operator=(Stack<T>&& other) noexcept = default;
+    Stack& operator=(const Stack& other) = default;
+    Stack& operator=(Stack&& other) noexcept = default;
 
     void push(const T& item) {
         sequence.append(item);
     }
 
+    void push(T&& item) {
+        sequence.append(std::move(item));
+    }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        return sequence.emplaceBack(std::forward<Args>(args)...);
+    }
+
     T pop() {
         if (isEmpty()) {
             throw std::runtime_error("Stack is empty");
         }
-        T item = sequence.getLast();
+        T item = std::move(sequence[sequence.getLength() - 1]);
         sequence.remove(sequence.getLength() - 1);
         return item;
     }
@@ -77,6 +96,10 @@ public:
         return sequence.get(index);
     }
 
+    Allocator getAllocator() const {
+        return sequence.getAllocator();
+    }
+
     int size() const {
         return sequence.getLength();
     }
@@ -91,28 +114,53 @@ public:
         }
     }
 
-    Stack<T> map(std::function<T(T)> f) const {
-        return Stack<T>(sequence.map(f));
+    Stack map(std::function<T(T)> f) const {
+        return Stack(sequence.map(f), getAllocator());
     }
 
-    Stack<T> where(std::function<bool(T)> predicate) const {
-        return Stack<T>(sequence.where(predicate));
+    Stack where(std::function<bool(T)> predicate) const {
+        return Stack(sequence.where(predicate), getAllocator());
     }
 
     T reduce(std::function<T(T, T)> reducer, T initial) const {
         return sequence.reduce(reducer, initial);
     }
 
-    Stack<T> concat(const Stack<T>& other) const {
+    Stack concat(const Stack& other) const {
         auto new_seq = sequence.clone();
         for (int i = 0; i < other.size(); ++i) {
             new_seq->append(other.sequence.get(i));
         }
-        return Stack<T>(new_seq);
+        return Stack(std::move(new_seq), getAllocator());
     }
 
-    Stack<T> getSubsequence(int startIndex, int endIndex) const {
-        return Stack<T>(sequence.getSubsequence(startIndex, endIndex));
+    // Элементы other переходят в конец без копирования, other остаётся пустым
+    void concatInPlace(Stack&& other) {
+        sequence.concatInPlace(std::move(other.sequence));
+    }
+
+    Stack concat(Stack&& other) const {
+        Stack result(*this);
+        result.concatInPlace(std::move(other));
+        return result;
+    }
+
+    template <typename ForwardIt>
+    void insertRange(int index, ForwardIt first, ForwardIt last) {
+        sequence.insertRange(index, first, last);
+    }
+
+    void removeRange(int startIndex, int endIndex) {
+        sequence.removeRange(startIndex, endIndex);
+    }
+
+    template <typename Predicate>
+    int removeIf(Predicate predicate) {
+        return sequence.removeIf(predicate);
+    }
+
+    Stack getSubsequence(int startIndex, int endIndex) const {
+        return Stack(sequence.getSubsequence(startIndex, endIndex), getAllocator());
     }
 
     bool contains(const T& item) const {
@@ -124,7 +172,7 @@ public:
         return false;
     }
 
-    bool containsSubsequence(const Stack<T>& sub) const {
+    bool containsSubsequence(const Stack& sub) const {
         if (sub.isEmpty()) return true;
         if (size() < sub.size()) return false;
 
@@ -141,6 +189,15 @@ public:
         return false;
     }
 
+    // Упорядочивает стек от дна к вершине: наибольший элемент окажется на вершине
+    void sort(std::function<bool(const T&, const T&)> comparator = nullptr) {
+        if (comparator) {
+            sequence.sort(comparator);
+        } else {
+            sequence.sort();
+        }
+    }
+
     template <typename U>
     Stack<std::pair<T, U>> zip(const Stack<U>& other) const {
         Stack<std::pair<T, U>> result;
@@ -151,8 +208,8 @@ public:
         return result;
     }
 
-    std::pair<Stack<T>, Stack<T>> split(std::function<bool(T)> predicate) const {
-        Stack<T> left, right;
+    std::pair<Stack, Stack> split(std::function<bool(T)> predicate) const {
+        Stack left(getAllocator()), right(getAllocator());
         for (int i = 0; i < sequence.getLength(); ++i) {
             T item = sequence.get(i);
             if (predicate(item)) {
@@ -164,7 +221,7 @@ public:
         return {left, right};
     }
 
-    bool operator==(const Stack<T>& other) const {
+    bool operator==(const Stack& other) const {
         if (size() != other.size()) return false;
         for (int i = 0; i < size(); ++i) {
             if (sequence.get(i) != other.sequence.get(i)) {
@@ -174,7 +231,7 @@ public:
         return true;
     }
 
-    bool operator!=(const Stack<T>& other) const {
+    bool operator!=(const Stack& other) const {
         return !(*this == other);
     }
 };
\ No newline at end of file
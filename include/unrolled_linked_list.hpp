@@ -0,0 +1,864 @@
+#pragma once
+
+#include "errors.hpp"
+#include "node_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detail {
+
+    // Около двух кэш-линий элементов на узел, но не меньше четырёх
+    template <typename T>
+    constexpr int defaultUnrolledCapacity() {
+        return std::max<int>(4, static_cast<int>(128 / sizeof(T)));
+    }
+}
+
+// Развёрнутый список: каждый узел хранит до NodeCapacity элементов подряд.
+// Интерфейс совпадает с LinkedList, поэтому его можно подставить
+// в MutableListSequence/ImmutableListSequence и адаптеры вместо LinkedList.
+// Пустых узлов в списке не бывает
+template <typename T, typename Allocator = std::allocator<T>,
+          int NodeCapacity = detail::defaultUnrolledCapacity<T>()>
+class UnrolledLinkedList {
+public:
+    using allocator_type = Allocator;
+
+private:
+    static_assert(NodeCapacity >= 2, "NodeCapacity must be at least 2");
+
+    // Обратная ссылка нужна, чтобы удаление с конца не искало предшественника от головы
+    struct Node {
+        Node* next;
+        Node* prev;
+        int count;
+        alignas(T) unsigned char storage[sizeof(T) * NodeCapacity];
+
+        T* items() { return reinterpret_cast<T*>(storage); }
+        const T* items() const { return reinterpret_cast<const T*>(storage); }
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodePool<Node, NodeAllocator> pool;
+    Node* head;
+    Node* tail;
+    int size;
+
+    // Узел последнего обращения по индексу и индекс его первого элемента,
+    // как курсор в LinkedList
+    mutable Node* cursor;
+    mutable int cursorStart;
+
+    // Как в LinkedList: число связей, по которым следующий узел
+    // не лежит в памяти сразу за текущим, и порог автоматического compact()
+    int scatteredLinks;
+    double compactionThreshold;
+
+    static int scattered(const Node* from, const Node* to) { return to != from + 1; }
+    void compactIfFragmented();
+
+    Node* createNode(Node* prev, Node* next);
+    void destroyNode(Node* node);
+    void linkBack(Node* node);
+    void unlink(Node* node);
+
+    Node* locate(int& index) const;
+    void insertIntoNode(Node* node, int offset, T&& value);
+    Node* splitNode(Node* node);
+    Node* splitNodeAt(Node* node, int keep);
+    void mergeWithNext(Node* node);
+
+    void copyFrom(const UnrolledLinkedList& other);
+    void moveFrom(UnrolledLinkedList&& other) noexcept;
+
+    template <bool Const>
+    class BasicIterator {
+    private:
+        using NodePointer = std::conditional_t<Const, const Node*, Node*>;
+        NodePointer node;
+        int offset;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<Const, const T*, T*>;
+        using reference         = std::conditional_t<Const, const T&, T&>;
+
+        explicit BasicIterator(NodePointer node = nullptr, int offset = 0) : node(node), offset(offset) {}
+
+        reference operator*() const { return node->items()[offset]; }
+        pointer operator->() const { return node->items() + offset; }
+
+        BasicIterator& operator++() {
+            if (++offset == node->count) {
+                node = node->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const BasicIterator& other) const {
+            return node == other.node && offset == other.offset;
+        }
+
+        bool operator!=(const BasicIterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+public:
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    UnrolledLinkedList();
+    explicit UnrolledLinkedList(const Allocator& allocator);
+    UnrolledLinkedList(T* items, int count, const Allocator& allocator = Allocator());
+    UnrolledLinkedList(const UnrolledLinkedList& other);
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept;
+
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other);
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other);
+
+    ~UnrolledLinkedList();
+
+    T getFirst() const;
+    T getLast() const;
+    T get(int index) const;
+
+    T& operator[](int index);
+    const T& operator[](int index) const;
+
+    int getLength() const;
+    Allocator getAllocator() const;
+    PoolStats getPoolStats() const;
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(); }
+
+    void append(T item);
+    void prepend(T item);
+    void insertAt(T item, int index);
+
+    template <typename... Args>
+    T& emplaceBack(Args&&... args);
+    template <typename... Args>
+    T& emplaceFront(Args&&... args);
+
+    void remove(int index);
+    void clear();
+
+    // Пакетные операции, как в LinkedList; узлы на стыках уплотняются один раз
+    template <typename ForwardIt>
+    void insertRange(int index, ForwardIt first, ForwardIt last);
+    void removeRange(int startIndex, int endIndex);
+    template <typename Predicate>
+    int removeIf(Predicate predicate);
+
+    // Как LinkedList::compact, но ещё и заполняет узлы целиком:
+    // узлов остаётся ceil(size / NodeCapacity)
+    void compact();
+    // Доля связей между несоседними в памяти узлами (а не элементами): 0 сразу после compact()
+    double getFragmentation() const;
+    // Порог автоматического compact() после insertAt, remove и пакетных операций, как в LinkedList
+    void setCompactionThreshold(double threshold);
+
+    void splice(UnrolledLinkedList&& other);
+
+    template <typename Compare = std::less<>>
+    void sort(Compare less = Compare());
+
+    UnrolledLinkedList* getSubList(int startIndex, int endIndex) const;
+    UnrolledLinkedList* clone() const;
+    UnrolledLinkedList* concat(const UnrolledLinkedList* other) const;
+    UnrolledLinkedList* concat(UnrolledLinkedList&& other) const;
+
+    bool operator==(const UnrolledLinkedList& other) const;
+    bool operator!=(const UnrolledLinkedList& other) const;
+};
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>::UnrolledLinkedList() : UnrolledLinkedList(A()) {}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>::UnrolledLinkedList(const A& allocator)
+    : pool(NodeAllocator(allocator)), head(nullptr), tail(nullptr), size(0),
+      cursor(nullptr), cursorStart(0), scatteredLinks(0), compactionThreshold(0) {}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>::UnrolledLinkedList(T* items, int count, const A& allocator)
+    : UnrolledLinkedList(allocator) {
+    if (count < 0) throw Errors::negativeCount();
+    for (int i = 0; i < count; ++i)
+        append(items[i]);
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>::UnrolledLinkedList(const UnrolledLinkedList& other)
+    : UnrolledLinkedList(A(NodeTraits::select_on_container_copy_construction(other.pool.getAllocator()))) {
+    compactionThreshold = other.compactionThreshold;
+    copyFrom(other);
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>::UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+    : pool(std::move(other.pool)), head(nullptr), tail(nullptr), size(0),
+      cursor(nullptr), cursorStart(0), scatteredLinks(0), compactionThreshold(other.compactionThreshold) {
+    moveFrom(std::move(other));
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>& UnrolledLinkedList<T, A, K>::operator=(const UnrolledLinkedList& other) {
+    if (this != &other) {
+        clear();
+        compactionThreshold = other.compactionThreshold;
+        copyFrom(other);
+    }
+    return *this;
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>& UnrolledLinkedList<T, A, K>::operator=(UnrolledLinkedList&& other) {
+    if (this != &other) {
+        clear();
+        compactionThreshold = other.compactionThreshold;
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value ||
+                      NodeTraits::is_always_equal::value) {
+            pool = std::move(other.pool);
+            moveFrom(std::move(other));
+        } else if (pool.getAllocator() == other.pool.getAllocator()) {
+            pool = std::move(other.pool);
+            moveFrom(std::move(other));
+        } else {
+            for (T& item : other)
+                emplaceBack(std::move(item));
+            other.clear();
+        }
+    }
+    return *this;
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>::~UnrolledLinkedList() {
+    clear();
+}
+
+template <typename T, typename A, int K>
+typename UnrolledLinkedList<T, A, K>::Node* UnrolledLinkedList<T, A, K>::createNode(Node* prev, Node* next) {
+    Node* node = ::new (static_cast<void*>(pool.allocate())) Node;
+    node->next = next;
+    node->prev = prev;
+    node->count = 0;
+    return node;
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::destroyNode(Node* node) {
+    std::destroy_n(node->items(), node->count);
+    pool.deallocate(node);
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::linkBack(Node* node) {
+    node->prev = tail;
+    if (!head) {
+        head = tail = node;
+    } else {
+        tail->next = node;
+        scatteredLinks += scattered(tail, node);
+        tail = node;
+    }
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::unlink(Node* node) {
+    if (node->prev)
+        scatteredLinks -= scattered(node->prev, node);
+    if (node->next)
+        scatteredLinks -= scattered(node, node->next);
+    if (node->prev && node->next)
+        scatteredLinks += scattered(node->prev, node->next);
+
+    if (node->prev)
+        node->prev->next = node->next;
+    else
+        head = node->next;
+    if (node->next)
+        node->next->prev = node->prev;
+    else
+        tail = node->prev;
+    if (cursor == node)
+        cursor = nullptr;
+    destroyNode(node);
+}
+
+// Находит узел с элементом index; index превращается в смещение внутри узла.
+// Хвостовой узел находится сразу, остальные — от курсора или от головы
+template <typename T, typename A, int K>
+typename UnrolledLinkedList<T, A, K>::Node* UnrolledLinkedList<T, A, K>::locate(int& index) const {
+    Node* current = head;
+    int start = 0;
+    if (index >= size - tail->count) {
+        current = tail;
+        start = size - tail->count;
+    } else if (cursor && index >= cursorStart) {
+        current = cursor;
+        start = cursorStart;
+    }
+    while (index - start >= current->count) {
+        start += current->count;
+        current = current->next;
+    }
+    cursor = current;
+    cursorStart = start;
+    index -= start;
+    return current;
+}
+
+// В узле должно быть свободное место
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::insertIntoNode(Node* node, int offset, T&& value) {
+    T* items = node->items();
+    if (offset == node->count) {
+        ::new (static_cast<void*>(items + offset)) T(std::move(value));
+    } else {
+        ::new (static_cast<void*>(items + node->count)) T(std::move(items[node->count - 1]));
+        std::move_backward(items + offset, items + node->count - 1, items + node->count);
+        items[offset] = std::move(value);
+    }
+    ++node->count;
+}
+
+// Переносит верхнюю половину полного узла в новый узел сразу за ним
+template <typename T, typename A, int K>
+typename UnrolledLinkedList<T, A, K>::Node* UnrolledLinkedList<T, A, K>::splitNode(Node* node) {
+    return splitNodeAt(node, node->count / 2);
+}
+
+// В узле остаются первые keep элементов, остальные переезжают в новый узел за ним
+template <typename T, typename A, int K>
+typename UnrolledLinkedList<T, A, K>::Node* UnrolledLinkedList<T, A, K>::splitNodeAt(Node* node, int keep) {
+    Node* right = createNode(node, node->next);
+    int moved = node->count - keep;
+    std::uninitialized_move_n(node->items() + keep, moved, right->items());
+    std::destroy_n(node->items() + keep, moved);
+    right->count = moved;
+    node->count = keep;
+    node->next = right;
+    if (right->next) {
+        scatteredLinks += scattered(right, right->next) - scattered(node, right->next);
+        right->next->prev = right;
+    } else {
+        tail = right;
+    }
+    scatteredLinks += scattered(node, right);
+    return right;
+}
+
+// Полупустой узел забирает содержимое соседа, чтобы узлы оставались плотными
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::mergeWithNext(Node* node) {
+    Node* next = node->next;
+    if (!next || node->count >= K / 2 || node->count + next->count > K)
+        return;
+    std::uninitialized_move_n(next->items(), next->count, node->items() + node->count);
+    node->count += next->count;
+    unlink(next);
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::copyFrom(const UnrolledLinkedList& other) {
+    for (const T& item : other)
+        append(item);
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::moveFrom(UnrolledLinkedList&& other) noexcept {
+    head = other.head;
+    tail = other.tail;
+    size = other.size;
+    cursor = other.cursor;
+    cursorStart = other.cursorStart;
+    scatteredLinks = other.scatteredLinks;
+    other.head = other.tail = other.cursor = nullptr;
+    other.size = other.scatteredLinks = 0;
+}
+
+template <typename T, typename A, int K>
+T UnrolledLinkedList<T, A, K>::getFirst() const {
+    if (!head) throw Errors::emptyList();
+    return head->items()[0];
+}
+
+template <typename T, typename A, int K>
+T UnrolledLinkedList<T, A, K>::getLast() const {
+    if (!tail) throw Errors::emptyList();
+    return tail->items()[tail->count - 1];
+}
+
+template <typename T, typename A, int K>
+T UnrolledLinkedList<T, A, K>::get(int index) const {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("Index: " + std::to_string(index));
+    Node* node = locate(index);
+    return node->items()[index];
+}
+
+template <typename T, typename A, int K>
+T& UnrolledLinkedList<T, A, K>::operator[](int index) {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+    Node* node = locate(index);
+    return node->items()[index];
+}
+
+template <typename T, typename A, int K>
+const T& UnrolledLinkedList<T, A, K>::operator[](int index) const {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("[] index: " + std::to_string(index));
+    Node* node = locate(index);
+    return node->items()[index];
+}
+
+template <typename T, typename A, int K>
+int UnrolledLinkedList<T, A, K>::getLength() const {
+    return size;
+}
+
+template <typename T, typename A, int K>
+A UnrolledLinkedList<T, A, K>::getAllocator() const {
+    return A(pool.getAllocator());
+}
+
+template <typename T, typename A, int K>
+PoolStats UnrolledLinkedList<T, A, K>::getPoolStats() const {
+    return pool.getStats();
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::append(T item) {
+    emplaceBack(std::move(item));
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::prepend(T item) {
+    insertAt(std::move(item), 0);
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::insertAt(T item, int index) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+    if (index == size) {
+        emplaceBack(std::move(item));
+        return;
+    }
+
+    Node* node = locate(index);
+    if (node->count == K) {
+        Node* right = splitNode(node);
+        if (index > node->count) {
+            index -= node->count;
+            node = right;
+        }
+    }
+    insertIntoNode(node, index, std::move(item));
+    ++size;
+    compactIfFragmented();
+}
+
+template <typename T, typename A, int K>
+template <typename... Args>
+T& UnrolledLinkedList<T, A, K>::emplaceBack(Args&&... args) {
+    if (!tail || tail->count == K) {
+        T value(std::forward<Args>(args)...);
+        Node* node = createNode(tail, nullptr);
+        try {
+            ::new (static_cast<void*>(node->items())) T(std::move(value));
+        } catch (...) {
+            pool.deallocate(node);
+            throw;
+        }
+        linkBack(node);
+    } else {
+        ::new (static_cast<void*>(tail->items() + tail->count)) T(std::forward<Args>(args)...);
+    }
+    ++tail->count;
+    ++size;
+    return tail->items()[tail->count - 1];
+}
+
+template <typename T, typename A, int K>
+template <typename... Args>
+T& UnrolledLinkedList<T, A, K>::emplaceFront(Args&&... args) {
+    insertAt(T(std::forward<Args>(args)...), 0);
+    return head->items()[0];
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::remove(int index) {
+    if (index < 0 || index >= size)
+        throw Errors::indexOutOfRange("Remove index: " + std::to_string(index));
+
+    Node* node = locate(index);
+    T* items = node->items();
+    std::move(items + index + 1, items + node->count, items + index);
+    std::destroy_at(items + node->count - 1);
+    --node->count;
+    --size;
+
+    // Начало узла не сдвинулось; опустевший узел уходит, и курсор встаёт на предыдущий
+    if (node->count == 0) {
+        Node* before = node->prev;
+        int beforeStart = before ? cursorStart - before->count : 0;
+        unlink(node);
+        cursor = before;
+        cursorStart = beforeStart;
+    } else {
+        mergeWithNext(node);
+    }
+    compactIfFragmented();
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (Node* current = head; current; current = current->next)
+            std::destroy_n(current->items(), current->count);
+    }
+    pool.release();
+    head = tail = cursor = nullptr;
+    size = scatteredLinks = 0;
+}
+
+// Новые элементы сначала собираются в отдельную цепочку плотных узлов из одного слэба,
+// так что при исключении список не меняется, а диапазон может указывать в сам список.
+// Цепочка вставляется целиком: разрезается не больше одного узла
+template <typename T, typename A, int K>
+template <typename ForwardIt>
+void UnrolledLinkedList<T, A, K>::insertRange(int index, ForwardIt first, ForwardIt last) {
+    if (index < 0 || index > size)
+        throw Errors::indexOutOfRange("Insert at index: " + std::to_string(index));
+    if (first == last) return;
+
+    UnrolledLinkedList chain(getAllocator());
+    chain.pool.reserve(static_cast<int>((std::distance(first, last) + K - 1) / K));
+    for (; first != last; ++first)
+        chain.emplaceBack(*first);
+
+    if (index == size) {
+        splice(std::move(chain));
+        compactIfFragmented();
+        return;
+    }
+    if (pool.getAllocator() != chain.pool.getAllocator()) {
+        for (T& item : chain)
+            insertAt(std::move(item), index++);
+        return;
+    }
+
+    int offset = index;
+    Node* node = locate(offset);
+    Node* before = node->prev;
+    if (offset > 0) {
+        splitNodeAt(node, offset);
+        before = node;
+    }
+    Node* after = before ? before->next : head;
+
+    pool.adopt(chain.pool);
+    if (before) {
+        scatteredLinks += scattered(before, chain.head) - scattered(before, after);
+        before->next = chain.head;
+    } else {
+        head = chain.head;
+    }
+    chain.head->prev = before;
+    chain.tail->next = after;
+    after->prev = chain.tail;
+    scatteredLinks += chain.scatteredLinks + scattered(chain.tail, after);
+    size += chain.size;
+
+    Node* chainTail = chain.tail;
+    chain.head = chain.tail = chain.cursor = nullptr;
+    chain.size = chain.scatteredLinks = 0;
+
+    mergeWithNext(chainTail);
+    if (before)
+        mergeWithNext(before);
+    cursor = nullptr;
+    compactIfFragmented();
+}
+
+// Удаляет полуинтервал [startIndex, endIndex), как LinkedList::removeRange.
+// Целиком покрытые узлы отцепляются, из крайних элементы вырезаются сдвигом
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::removeRange(int startIndex, int endIndex) {
+    if (startIndex < 0 || endIndex > size || startIndex > endIndex)
+        throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                     ", End: " + std::to_string(endIndex));
+    if (startIndex == endIndex) return;
+    if (endIndex - startIndex == size) {
+        clear();
+        return;
+    }
+
+    int offset = startIndex;
+    Node* node = locate(offset);
+    Node* before = offset > 0 ? node : node->prev;
+    int remaining = endIndex - startIndex;
+    while (remaining > 0) {
+        Node* next = node->next;
+        int erased = std::min(node->count - offset, remaining);
+        if (erased == node->count) {
+            unlink(node);
+        } else {
+            T* items = node->items();
+            std::move(items + offset + erased, items + node->count, items + offset);
+            std::destroy_n(items + node->count - erased, erased);
+            node->count -= erased;
+        }
+        remaining -= erased;
+        node = next;
+        offset = 0;
+    }
+
+    size -= endIndex - startIndex;
+    cursor = nullptr;
+    mergeWithNext(before ? before : head);
+    compactIfFragmented();
+}
+
+// Оставшиеся элементы сохраняют порядок; возвращает число удалённых.
+// Каждый узел сжимается на месте. Если predicate бросит исключение,
+// непроверенные элементы узла сдвигаются к оставленным и список остаётся целым
+template <typename T, typename A, int K>
+template <typename Predicate>
+int UnrolledLinkedList<T, A, K>::removeIf(Predicate predicate) {
+    int removed = 0;
+    cursor = nullptr;
+    Node* node = head;
+    while (node) {
+        Node* next = node->next;
+        T* items = node->items();
+        int kept = 0;
+        int checked = 0;
+        try {
+            for (; checked < node->count; ++checked) {
+                if (predicate(items[checked]))
+                    continue;
+                if (kept != checked)
+                    items[kept] = std::move(items[checked]);
+                ++kept;
+            }
+        } catch (...) {
+            int dropped = checked - kept;
+            if (dropped > 0) {
+                std::move(items + checked, items + node->count, items + kept);
+                std::destroy_n(items + node->count - dropped, dropped);
+            }
+            node->count -= dropped;
+            size -= dropped;
+            if (node->count == 0)
+                unlink(node);
+            throw;
+        }
+
+        int dropped = node->count - kept;
+        std::destroy_n(items + kept, dropped);
+        node->count = kept;
+        size -= dropped;
+        removed += dropped;
+        if (kept == 0)
+            unlink(node);
+        node = next;
+    }
+
+    if (size == 0) {
+        clear();
+        return removed;
+    }
+    for (node = head; node;) {
+        Node* next = node->next;
+        mergeWithNext(node);
+        if (node->next == next)
+            node = next;
+    }
+    compactIfFragmented();
+    return removed;
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::compact() {
+    if (size == 0) return;
+
+    NodePool<Node, NodeAllocator> fresh(pool.getAllocator());
+    fresh.reserve((size + K - 1) / K);
+    Node* newHead = nullptr;
+    Node* newTail = nullptr;
+    int newScattered = 0;
+    try {
+        for (T& item : *this) {
+            if (!newTail || newTail->count == K) {
+                Node* node = ::new (static_cast<void*>(fresh.allocate())) Node;
+                node->next = nullptr;
+                node->prev = newTail;
+                node->count = 0;
+                if (newTail) {
+                    newTail->next = node;
+                    newScattered += scattered(newTail, node);
+                } else {
+                    newHead = node;
+                }
+                newTail = node;
+            }
+            ::new (static_cast<void*>(newTail->items() + newTail->count)) T(std::move_if_noexcept(item));
+            ++newTail->count;
+        }
+    } catch (...) {
+        for (Node* node = newHead; node; node = node->next)
+            std::destroy_n(node->items(), node->count);
+        throw;
+    }
+
+    int length = size;
+    clear();
+    pool = std::move(fresh);
+    head = newHead;
+    tail = newTail;
+    size = length;
+    scatteredLinks = newScattered;
+}
+
+template <typename T, typename A, int K>
+double UnrolledLinkedList<T, A, K>::getFragmentation() const {
+    int nodes = pool.getStats().used;
+    if (nodes < 2) return 0.0;
+    return static_cast<double>(scatteredLinks) / (nodes - 1);
+}
+
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::setCompactionThreshold(double threshold) {
+    compactionThreshold = threshold;
+    compactIfFragmented();
+}
+
+// Порог размера тот же, что в LinkedList
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::compactIfFragmented() {
+    constexpr int MIN_AUTO_COMPACT_SIZE = 64;
+    if (compactionThreshold > 0 && size >= MIN_AUTO_COMPACT_SIZE &&
+        getFragmentation() > compactionThreshold)
+        compact();
+}
+
+// Как LinkedList::splice; узлы на стыке не уплотняются
+template <typename T, typename A, int K>
+void UnrolledLinkedList<T, A, K>::splice(UnrolledLinkedList&& other) {
+    if (this == &other || other.size == 0)
+        return;
+
+    if (pool.getAllocator() != other.pool.getAllocator()) {
+        for (T& item : other)
+            emplaceBack(std::move(item));
+        other.clear();
+        return;
+    }
+
+    pool.adopt(other.pool);
+    other.head->prev = tail;
+    if (tail) {
+        tail->next = other.head;
+        scatteredLinks += scattered(tail, other.head);
+    } else {
+        head = other.head;
+    }
+    tail = other.tail;
+    size += other.size;
+    scatteredLinks += other.scatteredLinks;
+    other.head = other.tail = other.cursor = nullptr;
+    other.size = other.scatteredLinks = 0;
+}
+
+// Элементы лежат внутри узлов, и перевесить их по одному нельзя:
+// они перемещаются во временный буфер, сортируются и возвращаются на свои места.
+// Узлы и их заполненность не меняются
+template <typename T, typename A, int K>
+template <typename Compare>
+void UnrolledLinkedList<T, A, K>::sort(Compare less) {
+    if (size < 2) return;
+
+    std::vector<T> buffer;
+    buffer.reserve(static_cast<std::size_t>(size));
+    for (T& item : *this)
+        buffer.push_back(std::move(item));
+    std::stable_sort(buffer.begin(), buffer.end(), less);
+
+    auto source = buffer.begin();
+    for (T& item : *this)
+        item = std::move(*source++);
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>* UnrolledLinkedList<T, A, K>::getSubList(int startIndex, int endIndex) const {
+    if (startIndex < 0 || endIndex >= size || startIndex > endIndex)
+        throw Errors::invalidIndices("Start: " + std::to_string(startIndex) +
+                                     ", End: " + std::to_string(endIndex));
+
+    auto* result = new UnrolledLinkedList(getAllocator());
+    int offset = startIndex;
+    Node* node = locate(offset);
+    const_iterator it(node, offset);
+    for (int i = startIndex; i <= endIndex; ++i, ++it)
+        result->append(*it);
+    return result;
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>* UnrolledLinkedList<T, A, K>::clone() const {
+    return new UnrolledLinkedList(*this);
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>* UnrolledLinkedList<T, A, K>::concat(const UnrolledLinkedList* other) const {
+    if (!other) throw Errors::nullList();
+    auto* result = new UnrolledLinkedList(*this);
+    for (const T& item : *other)
+        result->append(item);
+    return result;
+}
+
+template <typename T, typename A, int K>
+UnrolledLinkedList<T, A, K>* UnrolledLinkedList<T, A, K>::concat(UnrolledLinkedList&& other) const {
+    auto* result = new UnrolledLinkedList(*this);
+    result->splice(std::move(other));
+    return result;
+}
+
+template <typename T, typename A, int K>
+bool UnrolledLinkedList<T, A, K>::operator==(const UnrolledLinkedList& other) const {
+    if (size != other.size) return false;
+    return std::equal(begin(), end(), other.begin());
+}
+
+template <typename T, typename A, int K>
+bool UnrolledLinkedList<T, A, K>::operator!=(const UnrolledLinkedList& other) const {
+    return !(*this == other);
+}
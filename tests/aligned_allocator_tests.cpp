@@ -0,0 +1,137 @@
+#include "catch.hpp"
+#include "aligned_allocator.hpp"
+#include "dynamic_array.hpp"
+#include "mutable_array_sequence.hpp"
+#include "mutable_list_sequence.hpp"
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace {
+    bool isAligned(const void* pointer, std::size_t alignment) {
+        return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+    }
+}
+
+TEST_CASE("AlignedAllocator Policies", "[AlignedAllocator]") {
+    SECTION("Small blocks are cache-line aligned") {
+        AlignedAllocator<char> allocator;
+        char* block = allocator.allocate(3);
+        REQUIRE(isAligned(block, 64));
+        REQUIRE(allocator.getLastPolicy() == AllocationPolicy::Aligned);
+        allocator.deallocate(block, 3);
+    }
+
+    SECTION("Custom alignment") {
+        AlignedAllocator<float, 128> allocator;
+        float* block = allocator.allocate(10);
+        REQUIRE(isAligned(block, 128));
+        allocator.deallocate(block, 10);
+    }
+
+    SECTION("Large blocks stay aligned whatever the policy") {
+        AlignedAllocator<int> allocator(1 << 16);
+        std::size_t count = (1 << 18) / sizeof(int);
+        int* block = allocator.allocate(count);
+        REQUIRE(isAligned(block, 64));
+        block[0] = 1;
+        block[count - 1] = 2;
+        AllocationPolicy policy = allocator.getLastPolicy();
+#if !defined(__linux__)
+        REQUIRE(policy == AllocationPolicy::Aligned);
+#endif
+        REQUIRE(std::string(toString(policy)) != "unknown");
+        allocator.deallocate(block, count);
+    }
+
+    SECTION("Explicit huge pages fall back when unavailable") {
+        AlignedAllocator<int> allocator(1 << 16, true);
+        std::size_t count = (1 << 18) / sizeof(int);
+        int* block = allocator.allocate(count);
+        REQUIRE(isAligned(block, 64));
+        block[count - 1] = 7;
+        REQUIRE(block[count - 1] == 7);
+        allocator.deallocate(block, count);
+    }
+
+    SECTION("Zero threshold disables mapping") {
+        AlignedAllocator<int> allocator(0);
+        int* block = allocator.allocate(1 << 20);
+        REQUIRE(allocator.getLastPolicy() == AllocationPolicy::Aligned);
+        allocator.deallocate(block, 1 << 20);
+    }
+
+    SECTION("Equality follows the threshold") {
+        REQUIRE(AlignedAllocator<int>() == AlignedAllocator<double>());
+        REQUIRE(AlignedAllocator<int>(1024) != AlignedAllocator<int>(2048));
+    }
+}
+
+TEST_CASE("AlignedAllocator In Containers", "[AlignedAllocator]") {
+    SECTION("DynamicArray growth keeps alignment") {
+        DynamicArray<double, AlignedAllocator<double>> array(AlignedAllocator<double>(1 << 16));
+        for (int i = 0; i < 50000; ++i) {
+            array.pushBack(i);
+            REQUIRE(isAligned(array.data(), 64));
+        }
+        REQUIRE(array.get(49999) == 49999);
+        REQUIRE(array.getAllocator().getHugePageThreshold() == (1 << 16));
+
+        array.shrinkToFit();
+        REQUIRE(isAligned(array.data(), 64));
+        REQUIRE(array.get(123) == 123);
+    }
+
+    SECTION("Sequences over aligned storage") {
+        MutableArraySequence<int, DynamicArray<int, AlignedAllocator<int>>> sequence;
+        for (int i = 0; i < 100; ++i)
+            sequence.append(i);
+        REQUIRE(isAligned(sequence.data(), 64));
+        auto* mapped = sequence.map([](const int& x) { return x * 2; });
+        REQUIRE(mapped->get(99) == 198);
+        delete mapped;
+
+        MutableListSequence<int, LinkedList<int, AlignedAllocator<int>>> list;
+        list.append(1);
+        list.append(2);
+        REQUIRE(list.getLast() == 2);
+    }
+}
+
+TEST_CASE("AlignedAllocator Move Assignment Between Unequal Allocators", "[AlignedAllocator]") {
+    using Array = DynamicArray<int, AlignedAllocator<int>>;
+    Array source{AlignedAllocator<int>(0)};
+    for (int i = 0; i < 10; ++i)
+        source.pushBack(i);
+    Array target{AlignedAllocator<int>(1 << 20)};
+
+    // Буфер нельзя забрать, элементы переносятся в память target
+    target = std::move(source);
+    REQUIRE(target.getSize() == 10);
+    REQUIRE(target[9] == 9);
+    REQUIRE(target.getAllocator().getHugePageThreshold() == (1u << 20));
+    REQUIRE_FALSE(std::is_nothrow_move_assignable_v<Array>);
+    REQUIRE(std::is_nothrow_move_assignable_v<DynamicArray<int>>);
+
+    // Узлы списка тоже нельзя забрать: элементы перемещаются, а не копируются,
+    // поэтому годятся и некопируемые типы
+    using List = LinkedList<std::unique_ptr<int>, AlignedAllocator<std::unique_ptr<int>>>;
+    List sourceList{AlignedAllocator<std::unique_ptr<int>>(0)};
+    for (int i = 0; i < 10; ++i)
+        sourceList.emplaceBack(std::make_unique<int>(i));
+    const int* first = sourceList[0].get();
+    List targetList{AlignedAllocator<std::unique_ptr<int>>(1 << 20)};
+
+    targetList = std::move(sourceList);
+    REQUIRE(targetList.getLength() == 10);
+    REQUIRE(targetList[0].get() == first);
+    REQUIRE(*targetList[9] == 9);
+    REQUIRE(sourceList.getLength() == 0);
+    REQUIRE(targetList.getAllocator().getHugePageThreshold() == (1u << 20));
+
+    LinkedList<std::unique_ptr<int>> plain;
+    plain.emplaceBack(std::make_unique<int>(1));
+    LinkedList<std::unique_ptr<int>> plainTarget;
+    plainTarget = std::move(plain);
+    REQUIRE(*plainTarget[0] == 1);
+}
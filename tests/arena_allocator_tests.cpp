@@ -0,0 +1,157 @@
+#include "catch.hpp"
+#include "arena_allocator.hpp"
+#include "mutable_array_sequence.hpp"
+#include "mutable_list_sequence.hpp"
+#include "immutable_list_sequence.hpp"
+#include "stack.hpp"
+#include "queue.hpp"
+#include "deque.hpp"
+#include <memory>
+#include <string>
+
+TEST_CASE("MonotonicArena Allocation", "[ArenaAllocator]") {
+    MonotonicArena arena(128);
+
+    SECTION("Allocations are aligned and counted") {
+        void* a = arena.allocate(3, 1);
+        void* b = arena.allocate(sizeof(double), alignof(double));
+        REQUIRE(a != nullptr);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(b) % alignof(double) == 0);
+        REQUIRE(arena.getBytesAllocated() == 3 + sizeof(double));
+        REQUIRE(arena.getBytesReserved() >= 128);
+    }
+
+    SECTION("Large requests get their own block") {
+        void* big = arena.allocate(10000, 16);
+        REQUIRE(big != nullptr);
+        REQUIRE(arena.getBytesReserved() >= 10000);
+    }
+
+    SECTION("Release frees everything at once") {
+        for (int i = 0; i < 100; ++i)
+            arena.allocate(64, 8);
+        arena.release();
+        REQUIRE(arena.getBytesAllocated() == 0);
+        REQUIRE(arena.getBytesReserved() == 0);
+    }
+
+    SECTION("Invalid alignment") {
+        REQUIRE_THROWS_WITH(arena.allocate(8, 3), Catch::Matchers::Contains("Invalid argument"));
+    }
+}
+
+TEST_CASE("ArenaAllocator With Containers", "[ArenaAllocator]") {
+    MonotonicArena arena;
+    ArenaAllocator<int> allocator(arena);
+
+    SECTION("DynamicArray draws from the arena") {
+        DynamicArray<int, ArenaAllocator<int>> arr(allocator);
+        for (int i = 0; i < 100; ++i)
+            arr.pushBack(i);
+        REQUIRE(arr[99] == 99);
+        REQUIRE(arena.getBytesAllocated() >= 100 * sizeof(int));
+        REQUIRE(arr.getAllocator() == allocator);
+    }
+
+    SECTION("LinkedList nodes draw from the arena") {
+        LinkedList<std::string, ArenaAllocator<std::string>> list{ArenaAllocator<std::string>(arena)};
+        list.append("a");
+        list.append("b");
+        list.prepend("z");
+        REQUIRE(list.getLength() == 3);
+        REQUIRE(list.getFirst() == "z");
+        REQUIRE(arena.getBytesAllocated() > 0);
+    }
+
+    SECTION("Array sequence results keep the allocator") {
+        using Array = DynamicArray<int, ArenaAllocator<int>>;
+        MutableArraySequence<int, Array> seq{Array(allocator)};
+        seq.append(1);
+        seq.append(2);
+        seq.append(3);
+        auto doubled = std::unique_ptr<Sequence<int>>(seq.map([](int x) { return x * 2; }));
+        REQUIRE(doubled->get(2) == 6);
+        REQUIRE(seq.getAllocator() == allocator);
+    }
+
+    SECTION("List sequence results keep the allocator") {
+        using List = LinkedList<int, ArenaAllocator<int>>;
+        MutableListSequence<int, List> seq{List(allocator)};
+        seq.append(1);
+        seq.append(2);
+        auto filtered = std::unique_ptr<Sequence<int>>(seq.where([](int x) { return x > 1; }));
+        REQUIRE(filtered->getLength() == 1);
+        auto sliced = std::unique_ptr<Sequence<int>>(seq.slice(1, 1));
+        REQUIRE(sliced->getLength() == 0);
+    }
+
+    SECTION("Adaptors propagate the allocator") {
+        using List = LinkedList<int, ArenaAllocator<int>>;
+        Stack<int, List> stack(allocator);
+        Queue<int, List> queue(allocator);
+        Deque<int, List> deque(allocator);
+        for (int i = 0; i < 5; ++i) {
+            stack.push(i);
+            queue.enqueue(i);
+            deque.pushBack(i);
+        }
+        REQUIRE(stack.pop() == 4);
+        REQUIRE(queue.dequeue() == 0);
+        deque.sort([](const int& a, const int& b) { return a > b; });
+        REQUIRE(deque.front() == 4);
+
+        auto parts = queue.split([](int x) { return x % 2 == 0; });
+        REQUIRE(parts.first.size() == 2);
+        REQUIRE(parts.first.getAllocator() == allocator);
+        REQUIRE(stack.map([](int x) { return x + 1; }).getAllocator() == allocator);
+        REQUIRE(deque.concat(deque).size() == 10);
+    }
+}
+
+TEST_CASE("ArenaAllocator Splice", "[ArenaAllocator]") {
+    MonotonicArena arena;
+    MonotonicArena otherArena;
+    using List = LinkedList<int, ArenaAllocator<int>>;
+
+    List first{ArenaAllocator<int>(arena)};
+    List shared{ArenaAllocator<int>(arena)};
+    List foreign{ArenaAllocator<int>(otherArena)};
+    for (int i = 0; i < 10; ++i) {
+        first.append(i);
+        shared.append(10 + i);
+        foreign.append(20 + i);
+    }
+
+    first.splice(std::move(shared));
+    first.splice(std::move(foreign));
+    REQUIRE(first.getLength() == 30);
+    REQUIRE(first.get(15) == 15);
+    REQUIRE(first.getLast() == 29);
+    REQUIRE(foreign.getLength() == 0);
+}
+
+TEST_CASE("ArenaAllocator Immutable List Assignment", "[ArenaAllocator]") {
+    MonotonicArena arena;
+    MonotonicArena otherArena;
+    using Immutable = ImmutableListSequence<int, LinkedList<int, ArenaAllocator<int>>>;
+    ArenaAllocator<int> allocator(arena);
+
+    Immutable source{allocator};
+    std::unique_ptr<Immutable> built(static_cast<Immutable*>(source.append(1)));
+    REQUIRE(built->get(0) == 1);
+
+    // Присвоенная последовательность делит узлы источника и выделяет новые из той же арены
+    Immutable assigned{ArenaAllocator<int>(otherArena)};
+    assigned = *built;
+    REQUIRE(assigned.getAllocator() == allocator);
+    std::unique_ptr<Sequence<int>> grown(assigned.append(2));
+    REQUIRE(grown->getLast() == 2);
+    REQUIRE(otherArena.getBytesAllocated() == 0);
+
+    Immutable moved{ArenaAllocator<int>(otherArena)};
+    moved = std::move(assigned);
+    REQUIRE(moved.getAllocator() == allocator);
+    std::unique_ptr<Sequence<int>> prepended(moved.prepend(0));
+    REQUIRE(prepended->getFirst() == 0);
+    REQUIRE(otherArena.getBytesAllocated() == 0);
+}
@@ -0,0 +1,269 @@
+#include "catch.hpp"
+#include "compact_linked_list.hpp"
+#include "mutable_list_sequence.hpp"
+#include "stack.hpp"
+#include "queue.hpp"
+#include "deque.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("CompactLinkedList Basic Operations", "[CompactLinkedList]") {
+    int init[] = {1, 2, 3, 4, 5};
+    CompactLinkedList<int> list(init, 5);
+
+    SECTION("Access") {
+        REQUIRE(list.getLength() == 5);
+        REQUIRE(list.getFirst() == 1);
+        REQUIRE(list.getLast() == 5);
+        REQUIRE(list.get(3) == 4);
+        list[2] = 30;
+        REQUIRE(list[2] == 30);
+    }
+
+    SECTION("Freed slots are reused") {
+        list.remove(1);
+        list.remove(2);
+        int capacity = list.getPoolStats().capacity;
+        list.insertAt(20, 1);
+        list.prepend(0);
+        int expected[] = {0, 1, 20, 3, 5};
+        REQUIRE(list == CompactLinkedList<int>(expected, 5));
+        REQUIRE(list.getPoolStats().capacity == capacity);
+        REQUIRE(list.getPoolStats().slabs == 1);
+    }
+
+    SECTION("Copies keep the layout") {
+        list.remove(0);
+        CompactLinkedList<int> copy(list);
+        REQUIRE(copy == list);
+        copy.append(6);
+        REQUIRE(copy.getLength() == 5);
+        REQUIRE(copy.getPoolStats().capacity == list.getPoolStats().capacity);
+        REQUIRE(list.getLength() == 4);
+    }
+
+    SECTION("Sublists, concat and splice") {
+        auto* sub = list.getSubList(1, 3);
+        REQUIRE(sub->get(0) == 2);
+        auto* joined = list.concat(sub);
+        REQUIRE(joined->getLength() == 8);
+        REQUIRE(joined->getLast() == 4);
+
+        CompactLinkedList<int> empty;
+        empty.splice(std::move(*joined));
+        REQUIRE(empty.getLength() == 8);
+        REQUIRE(joined->getLength() == 0);
+        list.splice(std::move(empty));
+        REQUIRE(list.getLength() == 13);
+        REQUIRE(list.getLast() == 4);
+        delete sub;
+        delete joined;
+    }
+
+    SECTION("Errors") {
+        REQUIRE_THROWS_WITH(list.get(5), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(list.insertAt(0, 7), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(list.getSubList(3, 1), Catch::Matchers::Contains("Invalid indices"));
+        list.clear();
+        REQUIRE_THROWS_WITH(list.getFirst(), Catch::Matchers::Contains("Empty list"));
+    }
+}
+
+TEST_CASE("CompactLinkedList Matches Reference", "[CompactLinkedList]") {
+    CompactLinkedList<std::string> list;
+    std::vector<std::string> reference;
+    std::mt19937 random(42);
+
+    for (int step = 0; step < 3000; ++step) {
+        int action = random() % 4;
+        if (action < 2 || reference.empty()) {
+            int index = random() % (reference.size() + 1);
+            std::string value = std::to_string(step);
+            list.insertAt(value, index);
+            reference.insert(reference.begin() + index, value);
+        } else {
+            int index = random() % reference.size();
+            list.remove(index);
+            reference.erase(reference.begin() + index);
+        }
+        if (!reference.empty()) {
+            int probe = random() % reference.size();
+            REQUIRE(list.get(probe) == reference[probe]);
+        }
+    }
+
+    REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+    REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+
+    list.sort();
+    std::sort(reference.begin(), reference.end());
+    REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+    REQUIRE(list.getLast() == reference.back());
+}
+
+TEST_CASE("CompactLinkedList As Sequence Backing", "[CompactLinkedList]") {
+    CompactListSequence<int> sequence;
+    for (int i = 0; i < 1000; ++i)
+        sequence.append(i);
+
+    auto* odd = sequence.where([](int x) { return x % 2 == 1; });
+    REQUIRE(odd->getLength() == 500);
+    REQUIRE(sequence.reduce([](int a, int b) { return a + b; }, 0) == 499500);
+    delete odd;
+
+    Stack<int, CompactLinkedList<int>> stack;
+    Queue<int, CompactLinkedList<int>> queue;
+    for (int i = 0; i < 100; ++i) {
+        stack.push(i);
+        queue.enqueue(i);
+    }
+    REQUIRE(stack.pop() == 99);
+    REQUIRE(queue.dequeue() == 0);
+    REQUIRE(queue.front() == 1);
+}
+
+TEST_CASE("CompactLinkedList Compact", "[CompactLinkedList]") {
+    CompactLinkedList<std::string> list;
+    for (int i = 0; i < 50; ++i)
+        list.prepend(std::to_string(i));
+    for (int i = 0; i < 10; ++i)
+        list.remove(i);
+
+    CompactListSequence<std::string> sequence(list);
+    sequence.compact();
+    list.compact();
+    REQUIRE(list.getLength() == 40);
+    REQUIRE(list.getFirst() == "48");
+    REQUIRE(list.getLast() == "0");
+    REQUIRE(list.getPoolStats().capacity == 40);
+    REQUIRE(sequence.get(1) == list.get(1));
+    list.append("end");
+    REQUIRE(list.getLast() == "end");
+}
+
+TEST_CASE("CompactLinkedList Bulk Operations", "[CompactLinkedList]") {
+    CompactLinkedList<std::string> list;
+    std::vector<std::string> reference;
+    for (int i = 0; i < 20; ++i) {
+        list.append(std::to_string(i));
+        reference.push_back(std::to_string(i));
+    }
+
+    SECTION("insertRange") {
+        std::vector<std::string> extra = {"a", "b", "c"};
+        list.insertRange(5, extra.begin(), extra.end());
+        reference.insert(reference.begin() + 5, extra.begin(), extra.end());
+        list.insertRange(0, extra.begin(), extra.begin() + 1);
+        reference.insert(reference.begin(), "a");
+        list.insertRange(list.getLength(), extra.begin(), extra.end());
+        reference.insert(reference.end(), extra.begin(), extra.end());
+        list.insertRange(3, extra.end(), extra.end());
+
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+        REQUIRE(list.get(6) == "a");
+        REQUIRE(list.getLast() == "c");
+
+        // Диапазон из самого списка, хотя массив ячеек при этом растёт
+        list.insertRange(1, list.begin(), list.end());
+        REQUIRE(list.getLength() == 2 * static_cast<int>(reference.size()));
+        REQUIRE(list.get(1) == reference[0]);
+        REQUIRE_THROWS_WITH(list.insertRange(-1, extra.begin(), extra.end()),
+                            Catch::Matchers::Contains("Index out of range"));
+    }
+
+    SECTION("removeRange") {
+        list.removeRange(3, 8);
+        reference.erase(reference.begin() + 3, reference.begin() + 8);
+        list.removeRange(0, 2);
+        reference.erase(reference.begin(), reference.begin() + 2);
+        list.removeRange(list.getLength() - 1, list.getLength());
+        reference.pop_back();
+        list.removeRange(4, 4);
+
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        REQUIRE(list.getLast() == reference.back());
+        REQUIRE(list.get(2) == reference[2]);
+        REQUIRE_THROWS_WITH(list.removeRange(3, 1), Catch::Matchers::Contains("Invalid indices"));
+
+        // Освободившиеся ячейки достаются следующим вставкам
+        int capacity = list.getPoolStats().capacity;
+        std::vector<std::string> extra = {"x", "y"};
+        list.insertRange(1, extra.begin(), extra.end());
+        REQUIRE(list.getPoolStats().capacity == capacity);
+        REQUIRE(list.get(2) == "y");
+
+        list.removeRange(0, list.getLength());
+        REQUIRE(list.getLength() == 0);
+    }
+
+    SECTION("removeIf") {
+        int removed = list.removeIf([](const std::string& s) { return s.size() == 1; });
+        REQUIRE(removed == 10);
+        REQUIRE(list.getLength() == 10);
+        REQUIRE(list.getFirst() == "10");
+        REQUIRE(list.getLast() == "19");
+        REQUIRE(list.get(5) == "15");
+
+        REQUIRE(list.removeIf([](const std::string&) { return true; }) == 10);
+        list.append("again");
+        REQUIRE(list.getFirst() == "again");
+    }
+}
+
+TEST_CASE("CompactLinkedList Fragmentation", "[CompactLinkedList]") {
+    CompactLinkedList<int> list;
+    std::mt19937 random(3);
+    for (int i = 0; i < 1000; ++i)
+        list.insertAt(static_cast<int>(random() % 1000), random() % (list.getLength() + 1));
+    REQUIRE(list.getFragmentation() > 0.5);
+
+    list.sort();
+    REQUIRE(list.getFragmentation() > 0.5);
+    list.compact();
+    REQUIRE(list.getFragmentation() == 0.0);
+
+    list.setCompactionThreshold(0.25);
+    for (int i = 0; i < 500; ++i) {
+        list.insertAt(i, random() % (list.getLength() + 1));
+        REQUIRE(list.getFragmentation() <= 0.25);
+    }
+
+    CompactLinkedList<int> assigned;
+    assigned = list;
+    for (int i = 0; i < 200; ++i)
+        assigned.remove(random() % assigned.getLength());
+    REQUIRE(assigned.getFragmentation() <= 0.25);
+
+    std::vector<int> extra(50, 7);
+    list.insertRange(100, extra.begin(), extra.end());
+    list.removeRange(10, 400);
+    list.removeIf([](int x) { return x % 3 == 0; });
+    REQUIRE(list.getFragmentation() <= 0.25);
+}
+
+TEST_CASE("CompactLinkedList Bulk Operations Through Adaptors", "[CompactLinkedList]") {
+    std::vector<int> items = {1, 2, 3, 4, 5, 6};
+
+    CompactListSequence<int> sequence;
+    sequence.insertRange(0, items.begin(), items.end());
+    sequence.removeRange(1, 3);
+    REQUIRE(sequence.removeIf([](int x) { return x == 6; }) == 1);
+    REQUIRE(sequence.getLength() == 3);
+    REQUIRE(sequence.get(1) == 4);
+
+    Deque<int, CompactLinkedList<int>> deque;
+    deque.insertRange(0, items.begin(), items.end());
+    deque.removeRange(0, 2);
+    REQUIRE(deque.removeIf([](int x) { return x % 2 == 0; }) == 2);
+    REQUIRE(deque.popFront() == 3);
+    REQUIRE(deque.popBack() == 5);
+
+    Stack<int, CompactLinkedList<int>> stack;
+    stack.insertRange(0, items.begin(), items.end());
+    stack.removeRange(4, 6);
+    REQUIRE(stack.pop() == 4);
+}
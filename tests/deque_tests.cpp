@@ -244,4 +244,18 @@ TEST_CASE("Deque Sorting", "[Deque]") {
         REQUIRE(d.get(1).length() <= d.get(2).length());
         REQUIRE(d.get(2).length() <= d.get(3).length());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Deque Bulk Operations", "[Deque]") {
+    Deque<int> d;
+    for (int i = 0; i < 10; ++i)
+        d.pushBack(i);
+
+    REQUIRE(d.removeIf([](int x) { return x < 3; }) == 3);
+    d.removeRange(0, 2);
+    REQUIRE(d.front() == 5);
+    int extra[] = {1, 2};
+    d.insertRange(d.size(), extra, extra + 2);
+    REQUIRE(d.size() == 7);
+    REQUIRE(d.popBack() == 2);
+}
@@ -1,5 +1,27 @@
 #include "catch.hpp"
 #include "dynamic_array.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Tracked {
+        static int constructed;
+        static int destroyed;
+        int value;
+
+        Tracked() : value(0) { ++constructed; }
+        Tracked(int v) : value(v) { ++constructed; }
+        Tracked(const Tracked& other) : value(other.value) { ++constructed; }
+        Tracked& operator=(const Tracked& other) = default;
+        ~Tracked() { ++destroyed; }
+
+        static void reset() { constructed = destroyed = 0; }
+    };
+
+    int Tracked::constructed = 0;
+    int Tracked::destroyed = 0;
+}
 
 TEST_CASE("DynamicArray Constructors", "[DynamicArray]") {
     SECTION("Default constructor") {
@@ -158,4 +180,402 @@ TEST_CASE("DynamicArray size Management", "[DynamicArray]") {
         small.resize(10);
         REQUIRE(small[0] == 42);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("DynamicArray Capacity Management", "[DynamicArray]") {
+    DynamicArray<int> arr;
+
+    SECTION("Default constructed array is empty") {
+        REQUIRE(arr.getSize() == 0);
+        REQUIRE(arr.getCapacity() == 0);
+    }
+
+    SECTION("PushBack grows geometrically") {
+        int reallocations = 0;
+        int lastCapacity = arr.getCapacity();
+        for (int i = 0; i < 1000; ++i) {
+            arr.pushBack(i);
+            if (arr.getCapacity() != lastCapacity) {
+                ++reallocations;
+                lastCapacity = arr.getCapacity();
+            }
+        }
+        REQUIRE(arr.getSize() == 1000);
+        REQUIRE(arr.getCapacity() >= 1000);
+        REQUIRE(reallocations < 20);
+        for (int i = 0; i < 1000; ++i) {
+            REQUIRE(arr[i] == i);
+        }
+    }
+
+    SECTION("PopBack keeps capacity") {
+        arr.pushBack(1);
+        arr.pushBack(2);
+        int capacity = arr.getCapacity();
+        arr.popBack();
+        REQUIRE(arr.getSize() == 1);
+        REQUIRE(arr.getCapacity() == capacity);
+        REQUIRE(arr[0] == 1);
+        arr.popBack();
+        REQUIRE_THROWS_WITH(arr.popBack(), Catch::Matchers::Contains("Empty array"));
+    }
+
+    SECTION("Reserve does not change size") {
+        arr.reserve(100);
+        REQUIRE(arr.getSize() == 0);
+        REQUIRE(arr.getCapacity() == 100);
+        arr.reserve(10);
+        REQUIRE(arr.getCapacity() == 100);
+        REQUIRE_THROWS_WITH(arr.reserve(-1), Catch::Matchers::Contains("Negative size not allowed"));
+    }
+
+    SECTION("ShrinkToFit releases spare capacity") {
+        arr.reserve(50);
+        arr.pushBack(7);
+        arr.shrinkToFit();
+        REQUIRE(arr.getCapacity() == 1);
+        REQUIRE(arr[0] == 7);
+    }
+
+    SECTION("InsertAt shifts the tail") {
+        arr.pushBack(1);
+        arr.pushBack(3);
+        arr.insertAt(1, 2);
+        arr.insertAt(0, 0);
+        arr.insertAt(4, 4);
+        REQUIRE(arr.getSize() == 5);
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(arr[i] == i);
+        }
+        REQUIRE_THROWS_WITH(arr.insertAt(6, 0), Catch::Matchers::Contains("Index out of range"));
+    }
+
+    SECTION("Clear keeps capacity but drops elements") {
+        DynamicArray<std::string> strings;
+        strings.pushBack("alpha");
+        strings.pushBack("beta");
+        int capacity = strings.getCapacity();
+        strings.clear();
+        REQUIRE(strings.getSize() == 0);
+        REQUIRE(strings.getCapacity() == capacity);
+        REQUIRE_THROWS_WITH(strings.get(0), Catch::Matchers::Contains("Index out of range"));
+    }
+}
+
+
+TEST_CASE("DynamicArray Raw Storage", "[DynamicArray]") {
+    Tracked::reset();
+
+    SECTION("Reserve constructs nothing") {
+        DynamicArray<Tracked> arr;
+        arr.reserve(1000);
+        REQUIRE(Tracked::constructed == 0);
+        REQUIRE(arr.getCapacity() == 1000);
+    }
+
+    SECTION("Only the live range is destroyed") {
+        {
+            DynamicArray<Tracked> arr;
+            arr.reserve(100);
+            arr.pushBack(Tracked(1));
+            arr.pushBack(Tracked(2));
+            arr.popBack();
+            REQUIRE(Tracked::constructed - Tracked::destroyed == 1);
+        }
+        REQUIRE(Tracked::constructed == Tracked::destroyed);
+    }
+
+    SECTION("Clear destroys elements") {
+        DynamicArray<Tracked> arr;
+        for (int i = 0; i < 10; ++i)
+            arr.pushBack(Tracked(i));
+        arr.clear();
+        REQUIRE(Tracked::constructed == Tracked::destroyed);
+    }
+
+    SECTION("Sized constructor value-initializes") {
+        DynamicArray<int> arr(4);
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(arr[i] == 0);
+    }
+}
+
+TEST_CASE("DynamicArray Bulk Copies", "[DynamicArray]") {
+    SECTION("Shifts keep order for trivial types") {
+        DynamicArray<int> arr;
+        for (int i = 1; i < 100; ++i)
+            arr.pushBack(i);
+        arr.insertAt(0, 0);
+        arr.remove(50);
+        arr.insertAt(50, 50);
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(arr[i] == i);
+    }
+
+    SECTION("Shifts keep order for non-trivial types") {
+        DynamicArray<std::string> arr;
+        arr.pushBack("b");
+        arr.pushBack("d");
+        arr.insertAt(0, "a");
+        arr.insertAt(2, "c");
+        arr.remove(3);
+        REQUIRE(arr.getSize() == 3);
+        REQUIRE(arr[0] == "a");
+        REQUIRE(arr[1] == "b");
+        REQUIRE(arr[2] == "c");
+    }
+
+    SECTION("AppendRange copies a slice") {
+        int init[] = {1, 2, 3, 4, 5};
+        DynamicArray<int> source(init, 5);
+        DynamicArray<int> arr;
+        arr.appendRange(source, 1, 3);
+        REQUIRE(arr.getSize() == 3);
+        REQUIRE(arr[0] == 2);
+        REQUIRE(arr[2] == 4);
+        REQUIRE_THROWS_WITH(arr.appendRange(source, 3, 3), Catch::Matchers::Contains("Invalid indices"));
+    }
+
+    SECTION("AppendRange from itself") {
+        DynamicArray<std::string> arr;
+        arr.pushBack("x");
+        arr.pushBack("y");
+        arr.appendRange(arr, 0, 2);
+        REQUIRE(arr.getSize() == 4);
+        REQUIRE(arr[2] == "x");
+        REQUIRE(arr[3] == "y");
+    }
+}
+
+TEST_CASE("SmallDynamicArray Inline Storage", "[DynamicArray]") {
+    SECTION("Small arrays stay inline") {
+        SmallDynamicArray<int, 4> arr;
+        REQUIRE(arr.getCapacity() == 4);
+        for (int i = 0; i < 4; ++i)
+            arr.pushBack(i);
+        REQUIRE(arr.isInline());
+        REQUIRE(arr.getCapacity() == 4);
+    }
+
+    SECTION("Spills to the heap and back") {
+        SmallDynamicArray<std::string, 2> arr;
+        arr.pushBack("a");
+        arr.pushBack("b");
+        arr.pushBack("c");
+        REQUIRE_FALSE(arr.isInline());
+        REQUIRE(arr.getCapacity() > 2);
+        arr.popBack();
+        arr.shrinkToFit();
+        REQUIRE(arr.isInline());
+        REQUIRE(arr[0] == "a");
+        REQUIRE(arr[1] == "b");
+    }
+
+    SECTION("Copy and move of inline contents") {
+        SmallDynamicArray<std::string, 4> arr;
+        arr.pushBack("x");
+        arr.pushBack("y");
+
+        SmallDynamicArray<std::string, 4> copy(arr);
+        REQUIRE(copy.isInline());
+        REQUIRE(copy == arr);
+
+        SmallDynamicArray<std::string, 4> moved(std::move(arr));
+        REQUIRE(moved.isInline());
+        REQUIRE(moved.getSize() == 2);
+        REQUIRE(moved[1] == "y");
+        REQUIRE(arr.getSize() == 0);
+
+        SmallDynamicArray<std::string, 4> assigned;
+        assigned.pushBack("z");
+        assigned = std::move(moved);
+        REQUIRE(assigned.getSize() == 2);
+        REQUIRE(assigned[0] == "x");
+    }
+
+    SECTION("Move of spilled contents steals the buffer") {
+        SmallDynamicArray<int, 2> arr;
+        for (int i = 0; i < 10; ++i)
+            arr.pushBack(i);
+        SmallDynamicArray<int, 2> moved(std::move(arr));
+        REQUIRE_FALSE(moved.isInline());
+        REQUIRE(moved.getSize() == 10);
+        REQUIRE(arr.isInline());
+        REQUIRE(arr.getCapacity() == 2);
+    }
+}
+
+TEST_CASE("DynamicArray Raw Access", "[DynamicArray]") {
+    int init[] = {1, 2, 3, 4};
+    DynamicArray<int> arr(init, 4);
+
+    SECTION("Data points at contiguous elements") {
+        int* raw = arr.data();
+        REQUIRE(raw[0] == 1);
+        REQUIRE(raw[3] == 4);
+        REQUIRE(arr.end() - arr.begin() == 4);
+    }
+
+    SECTION("Range-based iteration") {
+        int sum = 0;
+        for (int value : arr)
+            sum += value;
+        REQUIRE(sum == 10);
+
+        for (int& value : arr)
+            value *= 2;
+        REQUIRE(arr[3] == 8);
+    }
+
+    SECTION("Unchecked accessors") {
+        arr.unsafeSet(2, 30);
+        REQUIRE(arr.unsafeGet(2) == 30);
+        const DynamicArray<int>& view = arr;
+        REQUIRE(*(view.begin() + 2) == 30);
+    }
+
+    SECTION("Empty array has an empty range") {
+        DynamicArray<int> empty;
+        REQUIRE(empty.begin() == empty.end());
+    }
+}
+
+TEST_CASE("DynamicArray Range Operations", "[DynamicArray]") {
+    int init[] = {0, 1, 2, 3, 4};
+
+    SECTION("Insert range without reallocation") {
+        DynamicArray<int> arr(init, 5);
+        arr.reserve(20);
+        int extra[] = {10, 11, 12};
+        arr.insertRange(2, extra, extra + 3);
+        int expected[] = {0, 1, 10, 11, 12, 2, 3, 4};
+        REQUIRE(arr == DynamicArray<int>(expected, 8));
+        REQUIRE(arr.getCapacity() == 20);
+    }
+
+    SECTION("Insert range with a single reallocation") {
+        DynamicArray<int> arr(init, 5);
+        std::vector<int> extra(100, 7);
+        arr.insertRange(5, extra.begin(), extra.end());
+        REQUIRE(arr.getSize() == 105);
+        REQUIRE(arr.get(4) == 4);
+        REQUIRE(arr.get(104) == 7);
+    }
+
+    SECTION("Insert range from the array itself") {
+        DynamicArray<int> arr(init, 5);
+        arr.reserve(20);
+        arr.insertRange(0, arr.begin() + 3, arr.end());
+        int expected[] = {3, 4, 0, 1, 2, 3, 4};
+        REQUIRE(arr == DynamicArray<int>(expected, 7));
+    }
+
+    SECTION("Non-trivial elements, short and long tails") {
+        std::string words[] = {"a", "b", "c", "d"};
+        std::string extra[] = {"x", "y"};
+
+        DynamicArray<std::string> shortTail(words, 4);
+        shortTail.reserve(10);
+        shortTail.insertRange(3, extra, extra + 2);
+        std::string expectedShort[] = {"a", "b", "c", "x", "y", "d"};
+        REQUIRE(shortTail == DynamicArray<std::string>(expectedShort, 6));
+
+        DynamicArray<std::string> longTail(words, 4);
+        longTail.reserve(10);
+        longTail.insertRange(1, extra, extra + 2);
+        std::string expectedLong[] = {"a", "x", "y", "b", "c", "d"};
+        REQUIRE(longTail == DynamicArray<std::string>(expectedLong, 6));
+    }
+
+    SECTION("Erase range") {
+        DynamicArray<int> arr(init, 5);
+        arr.eraseRange(1, 4);
+        REQUIRE(arr.getSize() == 2);
+        REQUIRE(arr.get(1) == 4);
+        arr.eraseRange(0, 0);
+        REQUIRE(arr.getSize() == 2);
+        REQUIRE_THROWS_WITH(arr.eraseRange(1, 3), Catch::Matchers::Contains("Invalid indices"));
+        REQUIRE_THROWS_WITH(arr.insertRange(3, init, init + 1), Catch::Matchers::Contains("Index out of range"));
+    }
+
+    SECTION("Remove if") {
+        DynamicArray<int> arr(init, 5);
+        int removed = arr.removeIf([](int x) { return x % 2 == 0; });
+        REQUIRE(removed == 3);
+        REQUIRE(arr.getSize() == 2);
+        REQUIRE(arr.get(0) == 1);
+        REQUIRE(arr.get(1) == 3);
+    }
+
+    SECTION("Every element is destroyed exactly once") {
+        Tracked::reset();
+        {
+            Tracked values[] = {1, 2, 3, 4, 5, 6};
+            DynamicArray<Tracked> arr(values, 6);
+            arr.insertRange(2, values, values + 6);
+            arr.eraseRange(0, 3);
+            arr.removeIf([](const Tracked& t) { return t.value > 4; });
+            REQUIRE(arr.getSize() == 5);
+        }
+        REQUIRE(Tracked::constructed == Tracked::destroyed);
+    }
+}
+
+namespace {
+    struct CopyCounter {
+        static int copies;
+        std::string payload;
+
+        CopyCounter(std::string text = "") : payload(std::move(text)) {}
+        CopyCounter(const CopyCounter& other) : payload(other.payload) { ++copies; }
+        CopyCounter(CopyCounter&&) noexcept = default;
+        CopyCounter& operator=(const CopyCounter& other) {
+            payload = other.payload;
+            ++copies;
+            return *this;
+        }
+        CopyCounter& operator=(CopyCounter&&) noexcept = default;
+    };
+
+    int CopyCounter::copies = 0;
+}
+
+TEST_CASE("DynamicArray Move Semantics", "[DynamicArray]") {
+    SECTION("Move-only elements") {
+        DynamicArray<std::unique_ptr<int>> arr;
+        for (int i = 0; i < 100; ++i)
+            arr.emplaceBack(new int(i));
+        arr.insertAt(0, std::make_unique<int>(-1));
+        arr.emplace(50, new int(500));
+        arr.remove(1);
+        arr.set(2, std::make_unique<int>(200));
+        REQUIRE(arr.getSize() == 101);
+        REQUIRE(*arr[0] == -1);
+        REQUIRE(*arr[2] == 200);
+        REQUIRE(*arr[49] == 500);
+        REQUIRE(*arr[100] == 99);
+    }
+
+    SECTION("Growth and insertion do not copy") {
+        CopyCounter::copies = 0;
+        DynamicArray<CopyCounter> arr;
+        for (int i = 0; i < 50; ++i)
+            arr.pushBack(CopyCounter(std::string(100, 'x')));
+        arr.emplaceBack("tail");
+        arr.insertAt(10, CopyCounter("middle"));
+        arr.emplace(0, "head");
+        arr.remove(5);
+        REQUIRE(arr.getSize() == 52);
+        REQUIRE(arr[0].payload == "head");
+        REQUIRE(arr[10].payload == "middle");
+        REQUIRE(CopyCounter::copies == 0);
+    }
+
+    SECTION("Emplace from an element of the same array") {
+        DynamicArray<std::string> arr;
+        arr.pushBack("first");
+        arr.shrinkToFit();
+        arr.emplaceBack(arr[0]);
+        REQUIRE(arr[1] == "first");
+    }
+}
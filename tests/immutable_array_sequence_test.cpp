@@ -116,3 +116,86 @@ TEST_CASE("ImmutableArraySequence Subsequence and Slice", "[ImmutableArraySequen
         REQUIRE(sliced->getLength() == 0);
     }
 }
+
+TEST_CASE("ImmutableArraySequence Shares Buffer", "[ImmutableArraySequence]") {
+    std::string values[] = {"a", "b", "c"};
+    ImmutableArraySequence<std::string> seq(values, 3);
+
+    SECTION("Copies, clones and assignment reuse the buffer") {
+        ImmutableArraySequence<std::string> copy(seq);
+        ImmutableArraySequence<std::string> assigned;
+        assigned = copy;
+        auto cloned = std::unique_ptr<Sequence<std::string>>(seq.clone());
+        auto whole = std::unique_ptr<Sequence<std::string>>(seq.getSubsequence(0, 2));
+
+        REQUIRE(copy.data() == seq.data());
+        REQUIRE(assigned.data() == seq.data());
+        REQUIRE(dynamic_cast<ImmutableArraySequence<std::string>*>(cloned.get())->data() == seq.data());
+        REQUIRE(dynamic_cast<ImmutableArraySequence<std::string>*>(whole.get())->data() == seq.data());
+    }
+
+    SECTION("Moved-from sequence stays usable") {
+        ImmutableArraySequence<std::string> moved(std::move(seq));
+        REQUIRE(moved.getLast() == "c");
+        REQUIRE(seq.getLength() == 3);
+    }
+
+    SECTION("Buffer outlives the original") {
+        auto* original = new ImmutableArraySequence<std::string>(values, 3);
+        ImmutableArraySequence<std::string> copy(*original);
+        delete original;
+        REQUIRE(copy.get(1) == "b");
+    }
+
+    SECTION("Derived versions get their own buffer") {
+        auto appended = std::unique_ptr<Sequence<std::string>>(seq.append("d"));
+        REQUIRE(dynamic_cast<ImmutableArraySequence<std::string>*>(appended.get())->data() != seq.data());
+        REQUIRE(seq.getLength() == 3);
+    }
+}
+
+namespace {
+    int sharedAllocations = 0;
+
+    template <typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        CountingAllocator() = default;
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>&) {}
+
+        T* allocate(std::size_t count) {
+            ++sharedAllocations;
+            return std::allocator<T>().allocate(count);
+        }
+        void deallocate(T* pointer, std::size_t count) {
+            std::allocator<T>().deallocate(pointer, count);
+        }
+
+        template <typename U>
+        bool operator==(const CountingAllocator<U>&) const { return true; }
+        template <typename U>
+        bool operator!=(const CountingAllocator<U>&) const { return false; }
+    };
+}
+
+TEST_CASE("ImmutableArraySequence Allocates Through Storage Allocator", "[ImmutableArraySequence]") {
+    using Small = ImmutableArraySequence<int, SmallDynamicArray<int, 4, CountingAllocator<int>>>;
+
+    Small first;
+    int before = sharedAllocations;
+    Small second;
+    Small fromNothing(nullptr, 0);
+    auto* sliced = first.slice(0, 0);
+    REQUIRE(sharedAllocations == before);
+    REQUIRE(second.data() == first.data());
+    REQUIRE(dynamic_cast<Small*>(sliced)->data() == first.data());
+    delete sliced;
+
+    // Буфер и счётчик ссылок лежат в одном блоке от аллокатора, элементы — во встроенном буфере
+    int values[] = {1, 2, 3};
+    Small small(values, 3);
+    REQUIRE(sharedAllocations == before + 1);
+    REQUIRE(small.getLast() == 3);
+}
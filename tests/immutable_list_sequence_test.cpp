@@ -119,3 +119,101 @@ TEST_CASE("ImmutableListSequence Edge Cases", "[ImmutableListSequence]") {
         REQUIRE(sliced->get(2) == 'd');
     }
 }
+
+TEST_CASE("ImmutableListSequence Structural Sharing", "[ImmutableListSequence]") {
+    using Seq = ImmutableListSequence<std::string>;
+    std::string items[] = {"a", "b", "c", "d"};
+    Seq base(items, 4);
+    // Адрес элемента показывает, из какого узла он читается
+    auto at = [](const Seq& seq, int index) { return &seq[index]; };
+
+    SECTION("Prepend, clone and suffix share nodes") {
+        std::unique_ptr<Seq> prepended(dynamic_cast<Seq*>(base.prepend("z")));
+        std::unique_ptr<Seq> copy(dynamic_cast<Seq*>(base.clone()));
+        std::unique_ptr<Seq> suffix(dynamic_cast<Seq*>(base.getSubsequence(2, 3)));
+
+        REQUIRE(at(*prepended, 1) == at(base, 0));
+        REQUIRE(at(*copy, 3) == at(base, 3));
+        REQUIRE(at(*suffix, 0) == at(base, 2));
+        REQUIRE(suffix->getLast() == "d");
+        REQUIRE(prepended->getLength() == 5);
+    }
+
+    SECTION("Insert and remove copy only the prefix") {
+        std::unique_ptr<Seq> inserted(dynamic_cast<Seq*>(base.insertAt("x", 1)));
+        std::unique_ptr<Seq> removed(dynamic_cast<Seq*>(base.remove(1)));
+
+        REQUIRE(inserted->get(1) == "x");
+        REQUIRE(at(*inserted, 2) == at(base, 1));
+        REQUIRE(at(*inserted, 0) != at(base, 0));
+        REQUIRE(removed->get(1) == "c");
+        REQUIRE(at(*removed, 1) == at(base, 2));
+        REQUIRE(removed->getLast() == "d");
+    }
+
+    SECTION("Versions stay valid after the original is gone") {
+        std::unique_ptr<Sequence<std::string>> tail;
+        {
+            Seq temporary(items, 4);
+            tail.reset(temporary.getSubsequence(1, 3));
+        }
+        REQUIRE(tail->getLength() == 3);
+        REQUIRE(tail->getFirst() == "b");
+        REQUIRE(tail->getLast() == "d");
+    }
+
+    SECTION("Concat shares the right operand") {
+        std::unique_ptr<Seq> joined(dynamic_cast<Seq*>(base.concat(&base)));
+        REQUIRE(joined->getLength() == 8);
+        REQUIRE(at(*joined, 4) == at(base, 0));
+        REQUIRE(joined->getLast() == "d");
+    }
+}
+
+TEST_CASE("ImmutableListSequence Long Chains", "[ImmutableListSequence]") {
+    auto* versions = new ImmutableListSequence<int>();
+    for (int i = 0; i < 200000; ++i) {
+        auto* next = dynamic_cast<ImmutableListSequence<int>*>(versions->prepend(i));
+        delete versions;
+        versions = next;
+    }
+    std::unique_ptr<Sequence<int>> dropped(versions->remove(0));
+    REQUIRE(versions->getFirst() == 199999);
+    REQUIRE(dropped->getFirst() == 199998);
+    REQUIRE(dropped->getLast() == 0);
+    delete versions;
+    REQUIRE(dropped->get(199998) == 0);
+}
+
+TEST_CASE("ImmutableListSequence Windows", "[ImmutableListSequence]") {
+    int items[] = {1, 2, 3, 4, 5, 6};
+    ImmutableListSequence<int> seq(items, 6);
+    std::unique_ptr<ImmutableListSequence<int>> window(
+        dynamic_cast<ImmutableListSequence<int>*>(seq.getSubsequence(1, 3)));
+    const ImmutableListSequence<int>& original = seq;
+
+    const ImmutableListSequence<int>& shared = *window;
+    REQUIRE(&shared[0] == &original[1]);
+    REQUIRE(window->getLength() == 3);
+    REQUIRE(window->getLast() == 4);
+    REQUIRE(window->reduce([](int a, int b) { return a + b; }, 0) == 9);
+    REQUIRE(std::unique_ptr<Sequence<int>>(window->where([](int x) { return x > 2; }))->getLength() == 2);
+
+    std::unique_ptr<Sequence<int>> appended(window->append(10));
+    REQUIRE(appended->getLength() == 4);
+    REQUIRE(appended->get(3) == 10);
+
+    std::unique_ptr<Sequence<int>> inserted(window->insertAt(20, 3));
+    REQUIRE(inserted->getLength() == 4);
+    REQUIRE(inserted->getLast() == 20);
+
+    std::unique_ptr<Sequence<int>> joined(window->concat(window.get()));
+    REQUIRE(joined->getLength() == 6);
+    REQUIRE(joined->get(3) == 2);
+    REQUIRE(joined->getLast() == 4);
+
+    std::unique_ptr<Sequence<int>> inner(window->slice(1, 2));
+    REQUIRE(inner->getLength() == 1);
+    REQUIRE(inner->getFirst() == 3);
+    REQUIRE(inner->getLast() == 3);
+}
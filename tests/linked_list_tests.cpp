@@ -1,5 +1,11 @@
 #include "catch.hpp"
 #include "linked_list.hpp"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+#include <memory>
+#include <string>
 
 TEST_CASE("LinkedList Constructors", "[LinkedList]") {
     SECTION("Default constructor") {
@@ -208,4 +214,424 @@ TEST_CASE("LinkedList Special Cases", "[LinkedList]") {
         REQUIRE(list[1] == 3);
         REQUIRE(list[2] == 2);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("LinkedList Emplace", "[LinkedList]") {
+    LinkedList<std::unique_ptr<std::string>> list;
+    list.emplaceBack(new std::string("b"));
+    list.emplaceFront(new std::string("a"));
+    list.append(std::make_unique<std::string>("c"));
+    list.insertAt(std::make_unique<std::string>("x"), 1);
+
+    REQUIRE(list.getLength() == 4);
+    REQUIRE(*list[0] == "a");
+    REQUIRE(*list[1] == "x");
+    REQUIRE(*list[3] == "c");
+
+    LinkedList<std::pair<int, std::string>> pairs;
+    auto& pair = pairs.emplaceBack(1, "one");
+    REQUIRE(pair.second == "one");
+    REQUIRE(pairs.getLast().first == 1);
+}
+
+TEST_CASE("LinkedList Node Pool", "[LinkedList]") {
+    LinkedList<std::string> list;
+    for (int i = 0; i < 100; ++i)
+        list.append(std::to_string(i));
+
+    SECTION("Nodes come from slabs") {
+        PoolStats stats = list.getPoolStats();
+        REQUIRE(stats.used == 100);
+        REQUIRE(stats.capacity >= 100);
+        REQUIRE(stats.slabs < 100);
+    }
+
+    SECTION("Removed nodes are reused") {
+        int capacity = list.getPoolStats().capacity;
+        for (int i = 0; i < 10000; ++i) {
+            list.remove(0);
+            list.append("x");
+        }
+        REQUIRE(list.getPoolStats().used == 100);
+        REQUIRE(list.getPoolStats().capacity == capacity);
+        REQUIRE(list.getLast() == "x");
+    }
+
+    SECTION("Clear releases every slab") {
+        list.clear();
+        PoolStats stats = list.getPoolStats();
+        REQUIRE(stats.slabs == 0);
+        REQUIRE(stats.capacity == 0);
+        REQUIRE(stats.used == 0);
+        list.append("again");
+        REQUIRE(list.getFirst() == "again");
+    }
+
+    SECTION("Moves carry the pool along") {
+        LinkedList<std::string> moved(std::move(list));
+        REQUIRE(moved.getPoolStats().used == 100);
+        REQUIRE(list.getPoolStats().slabs == 0);
+
+        LinkedList<std::string> assigned;
+        assigned.append("old");
+        assigned = std::move(moved);
+        REQUIRE(assigned.getPoolStats().used == 100);
+        REQUIRE(assigned.get(99) == "99");
+    }
+}
+
+TEST_CASE("LinkedList Iterators", "[LinkedList]") {
+    int init[] = {1, 2, 3};
+    LinkedList<int> list(init, 3);
+
+    for (int& item : list)
+        item *= 10;
+
+    const LinkedList<int>& view = list;
+    int sum = 0;
+    for (const int& item : view)
+        sum += item;
+    REQUIRE(sum == 60);
+    REQUIRE(*std::next(list.begin(), 2) == 30);
+    REQUIRE(LinkedList<int>().begin() == LinkedList<int>().end());
+}
+
+TEST_CASE("LinkedList Both Ends", "[LinkedList]") {
+    LinkedList<int> list;
+    for (int i = 0; i < 10; ++i)
+        list.append(i);
+
+    SECTION("Indices in the second half") {
+        REQUIRE(list.get(9) == 9);
+        REQUIRE(list.get(6) == 6);
+        list.insertAt(70, 7);
+        REQUIRE(list.get(7) == 70);
+        REQUIRE(list.get(8) == 7);
+        list.remove(8);
+        REQUIRE(list.get(8) == 8);
+    }
+
+    SECTION("Draining from the tail") {
+        for (int i = 9; i >= 0; --i) {
+            REQUIRE(list.getLast() == i);
+            list.remove(list.getLength() - 1);
+        }
+        REQUIRE(list.getLength() == 0);
+        list.append(1);
+        list.prepend(0);
+        REQUIRE(list.getFirst() == 0);
+        REQUIRE(list.getLast() == 1);
+    }
+
+    SECTION("Links stay consistent in both directions") {
+        list.remove(0);
+        list.remove(4);
+        list.prepend(-1);
+        list.insertAt(100, 5);
+        int expected[] = {-1, 1, 2, 3, 4, 100, 6, 7, 8, 9};
+        for (int i = 9; i >= 0; --i)
+            REQUIRE(list.get(i) == expected[i]);
+        REQUIRE(list == LinkedList<int>(expected, 10));
+    }
+}
+
+TEST_CASE("LinkedList Cursor", "[LinkedList]") {
+    SECTION("Sequential index loops over a large list") {
+        LinkedList<int> list;
+        for (int i = 0; i < 100000; ++i)
+            list.append(i);
+        const LinkedList<int>& view = list;
+        long long sum = 0;
+        for (int i = 0; i < view.getLength(); ++i)
+            sum += view.get(i);
+        REQUIRE(sum == 4999950000LL);
+        for (int i = view.getLength() - 1; i >= 0; --i)
+            REQUIRE(view[i] == i);
+    }
+
+    SECTION("Cursor survives modifications") {
+        LinkedList<int> list;
+        std::vector<int> reference;
+        std::mt19937 random(7);
+        for (int step = 0; step < 3000; ++step) {
+            int action = random() % 5;
+            if (action < 2 || reference.empty()) {
+                int index = random() % (reference.size() + 1);
+                list.insertAt(step, index);
+                reference.insert(reference.begin() + index, step);
+            } else if (action == 2) {
+                list.prepend(step);
+                reference.insert(reference.begin(), step);
+            } else {
+                int index = random() % reference.size();
+                list.remove(index);
+                reference.erase(reference.begin() + index);
+            }
+            if (!reference.empty()) {
+                int probe = random() % reference.size();
+                REQUIRE(list.get(probe) == reference[probe]);
+            }
+        }
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+    }
+}
+
+TEST_CASE("LinkedList Splice", "[LinkedList]") {
+    LinkedList<std::string> first;
+    LinkedList<std::string> second;
+    for (int i = 0; i < 50; ++i) {
+        first.append("a" + std::to_string(i));
+        second.append("b" + std::to_string(i));
+    }
+    second.remove(0);
+
+    SECTION("Nodes and slabs move over") {
+        PoolStats before = first.getPoolStats();
+        int secondSlabs = second.getPoolStats().slabs;
+        first.splice(std::move(second));
+
+        REQUIRE(first.getLength() == 99);
+        REQUIRE(second.getLength() == 0);
+        REQUIRE(second.getPoolStats().slabs == 0);
+        REQUIRE(first.getPoolStats().slabs == before.slabs + secondSlabs);
+        REQUIRE(first.getPoolStats().used == 99);
+        REQUIRE(first.get(50) == "b1");
+        REQUIRE(first.getLast() == "b49");
+
+        // Узлы из чужого пула освобождаются и переиспользуются как свои
+        int capacity = first.getPoolStats().capacity;
+        for (int i = 0; i < 99; ++i)
+            first.remove(first.getLength() - 1);
+        for (int i = 0; i < 99; ++i)
+            first.prepend("c");
+        REQUIRE(first.getPoolStats().capacity == capacity);
+
+        second.append("reuse");
+        REQUIRE(second.getFirst() == "reuse");
+    }
+
+    SECTION("Splice into an empty list") {
+        LinkedList<std::string> empty;
+        empty.splice(std::move(first));
+        REQUIRE(empty.getLength() == 50);
+        REQUIRE(empty.getFirst() == "a0");
+        empty.splice(std::move(first));
+        REQUIRE(empty.getLength() == 50);
+    }
+
+    SECTION("Rvalue concat copies only the left side") {
+        LinkedList<std::string>* joined = first.concat(std::move(second));
+        REQUIRE(joined->getLength() == 99);
+        REQUIRE(first.getLength() == 50);
+        REQUIRE(second.getLength() == 0);
+        REQUIRE((*joined)[98] == "b49");
+        delete joined;
+    }
+}
+
+TEST_CASE("LinkedList Sort", "[LinkedList]") {
+    SECTION("Matches stable_sort and keeps the nodes") {
+        std::mt19937 rng(7);
+        for (int length : {0, 1, 2, 3, 17, 64, 1000}) {
+            LinkedList<std::pair<int, int>> list;
+            std::vector<std::pair<int, int>> reference;
+            for (int i = 0; i < length; ++i) {
+                std::pair<int, int> item{static_cast<int>(rng() % 10), i};
+                list.append(item);
+                reference.push_back(item);
+            }
+            PoolStats before = list.getPoolStats();
+
+            auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                return a.first < b.first;
+            };
+            list.sort(byKey);
+            std::stable_sort(reference.begin(), reference.end(), byKey);
+
+            REQUIRE(list.getLength() == length);
+            REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+            REQUIRE(list.getPoolStats().capacity == before.capacity);
+            REQUIRE(list.getPoolStats().used == before.used);
+            if (length > 0) {
+                REQUIRE(list.getLast() == reference.back());
+                // Обратные ссылки тоже переставлены
+                REQUIRE(list.get(length - 1 - length / 3) == reference[length - 1 - length / 3]);
+            }
+        }
+    }
+
+    SECTION("Default order and element addresses") {
+        LinkedList<std::string> list;
+        for (const char* word : {"pear", "apple", "kiwi", "banana"})
+            list.append(word);
+        const std::string* kiwi = &list[2];
+
+        list.sort();
+        REQUIRE(list.getFirst() == "apple");
+        REQUIRE(list.getLast() == "pear");
+        REQUIRE(&list[2] == kiwi);
+
+        list.sort(std::greater<>());
+        REQUIRE(list.getFirst() == "pear");
+        list.remove(3);
+        REQUIRE(list.getLast() == "banana");
+    }
+
+    SECTION("Throwing comparator leaves the list whole") {
+        LinkedList<int> list;
+        for (int i = 0; i < 100; ++i)
+            list.append(100 - i);
+        int calls = 0;
+        REQUIRE_THROWS(list.sort([&calls](int a, int b) {
+            if (++calls == 150) throw std::runtime_error("comparator");
+            return a < b;
+        }));
+        REQUIRE(list.getLength() == 100);
+        REQUIRE(std::distance(list.begin(), list.end()) == 100);
+        int sum = 0;
+        for (int item : list) sum += item;
+        REQUIRE(sum == 5050);
+        while (list.getLength() > 0)
+            list.remove(list.getLength() - 1);
+    }
+}
+
+TEST_CASE("LinkedList Compact", "[LinkedList]") {
+    LinkedList<std::string> list;
+    std::vector<std::string> reference;
+    std::mt19937 random(3);
+    for (int step = 0; step < 2000; ++step) {
+        int index = random() % (reference.size() + 1);
+        list.insertAt(std::to_string(step), index);
+        reference.insert(reference.begin() + index, std::to_string(step));
+        if (step % 3 == 0) {
+            int removed = random() % reference.size();
+            list.remove(removed);
+            reference.erase(reference.begin() + removed);
+        }
+    }
+
+    SECTION("Explicit compact keeps order and packs the pool") {
+        REQUIRE(list.getFragmentation() > 0.5);
+        list.compact();
+        REQUIRE(list.getFragmentation() == 0.0);
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+        REQUIRE(list.getLast() == reference.back());
+        PoolStats stats = list.getPoolStats();
+        REQUIRE(stats.slabs == 1);
+        REQUIRE(stats.capacity == list.getLength());
+
+        list.append("tail");
+        list.remove(0);
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        REQUIRE(list.get(list.getLength() - 2) == reference.back());
+    }
+
+    SECTION("Sorting recomputes fragmentation") {
+        LinkedList<int> sorted;
+        for (int i = 0; i < 100; ++i)
+            sorted.append(i);
+        // Разрывы только на границах слэбов
+        REQUIRE(sorted.getFragmentation() < 0.05);
+        sorted.sort(std::greater<>());
+        REQUIRE(sorted.getFragmentation() == 1.0);
+        sorted.compact();
+        REQUIRE(sorted.getFirst() == 99);
+        REQUIRE(sorted.getFragmentation() == 0.0);
+    }
+
+    SECTION("Threshold triggers compaction") {
+        list.setCompactionThreshold(0.25);
+        REQUIRE(list.getFragmentation() == 0.0);
+        for (int step = 0; step < 500; ++step) {
+            int index = random() % (reference.size() + 1);
+            list.insertAt("x", index);
+            reference.insert(reference.begin() + index, "x");
+            REQUIRE(list.getFragmentation() <= 0.25);
+        }
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+
+        LinkedList<std::string> copy(list);
+        copy.insertAt("y", 10);
+        REQUIRE(copy.getFragmentation() <= 0.25);
+
+        LinkedList<std::string> assigned;
+        assigned = list;
+        for (int step = 0; step < 200; ++step)
+            assigned.insertAt("y", random() % (assigned.getLength() + 1));
+        REQUIRE(assigned.getFragmentation() <= 0.25);
+        LinkedList<std::string> moved;
+        moved = std::move(assigned);
+        for (int step = 0; step < 200; ++step)
+            moved.insertAt("z", random() % (moved.getLength() + 1));
+        REQUIRE(moved.getFragmentation() <= 0.25);
+    }
+}
+
+TEST_CASE("LinkedList Bulk Operations", "[LinkedList]") {
+    LinkedList<std::string> list;
+    std::vector<std::string> reference;
+    for (int i = 0; i < 20; ++i) {
+        list.append(std::to_string(i));
+        reference.push_back(std::to_string(i));
+    }
+
+    SECTION("insertRange") {
+        std::vector<std::string> extra = {"a", "b", "c"};
+        list.insertRange(5, extra.begin(), extra.end());
+        reference.insert(reference.begin() + 5, extra.begin(), extra.end());
+        list.insertRange(0, extra.begin(), extra.begin() + 1);
+        reference.insert(reference.begin(), "a");
+        list.insertRange(list.getLength(), extra.begin(), extra.end());
+        reference.insert(reference.end(), extra.begin(), extra.end());
+        list.insertRange(3, extra.end(), extra.end());
+
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+        REQUIRE(list.get(6) == "a");
+        REQUIRE(list.getLast() == "c");
+
+        // Диапазон из самого списка
+        list.insertRange(1, list.begin(), list.end());
+        REQUIRE(list.getLength() == 2 * static_cast<int>(reference.size()));
+        REQUIRE(list.get(1) == reference[0]);
+        REQUIRE_THROWS_WITH(list.insertRange(-1, extra.begin(), extra.end()),
+                            Catch::Matchers::Contains("Index out of range"));
+    }
+
+    SECTION("removeRange") {
+        list.removeRange(3, 8);
+        reference.erase(reference.begin() + 3, reference.begin() + 8);
+        list.removeRange(0, 2);
+        reference.erase(reference.begin(), reference.begin() + 2);
+        list.removeRange(list.getLength() - 1, list.getLength());
+        reference.pop_back();
+        list.removeRange(4, 4);
+
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        REQUIRE(list.getLast() == reference.back());
+        REQUIRE(list.get(2) == reference[2]);
+        REQUIRE_THROWS_WITH(list.removeRange(3, 1), Catch::Matchers::Contains("Invalid indices"));
+
+        list.removeRange(0, list.getLength());
+        REQUIRE(list.getLength() == 0);
+        REQUIRE(list.getPoolStats().slabs == 0);
+    }
+
+    SECTION("removeIf") {
+        int removed = list.removeIf([](const std::string& s) { return s.size() == 1; });
+        REQUIRE(removed == 10);
+        REQUIRE(list.getLength() == 10);
+        REQUIRE(list.getFirst() == "10");
+        REQUIRE(list.getLast() == "19");
+        REQUIRE(list.get(5) == "15");
+        list.remove(list.getLength() - 1);
+        REQUIRE(list.getLast() == "18");
+
+        REQUIRE(list.removeIf([](const std::string&) { return true; }) == 9);
+        REQUIRE(list.getPoolStats().slabs == 0);
+        list.append("again");
+        REQUIRE(list.getFirst() == "again");
+    }
+}
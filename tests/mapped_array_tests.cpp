@@ -0,0 +1,179 @@
+#include "catch.hpp"
+#include "mapped_array_sequence.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+    // Временный пустой файл, удаляется вместе с объектом
+    struct TempFile {
+        std::string path;
+
+        TempFile() {
+            char name[] = "/tmp/mapped_array_XXXXXX";
+            int descriptor = ::mkstemp(name);
+            REQUIRE(descriptor >= 0);
+            ::close(descriptor);
+            path = name;
+        }
+
+        ~TempFile() {
+            std::remove(path.c_str());
+        }
+
+        long fileSize() const {
+            struct stat info;
+            ::stat(path.c_str(), &info);
+            return static_cast<long>(info.st_size);
+        }
+    };
+}
+
+TEST_CASE("MappedArray Basic Operations", "[MappedArray]") {
+    TempFile file;
+
+    SECTION("Empty file") {
+        MappedArray<int> array(file.path);
+        REQUIRE(array.getSize() == 0);
+        REQUIRE(array.getCapacity() == 0);
+        REQUIRE_FALSE(array.isReadOnly());
+    }
+
+    SECTION("Growth and persistence") {
+        {
+            MappedArray<int> array(file.path);
+            for (int i = 0; i < 10000; ++i)
+                array.pushBack(i);
+            REQUIRE(array.getSize() == 10000);
+            REQUIRE(array.getCapacity() >= 10000);
+            REQUIRE(array.get(9999) == 9999);
+        }
+        REQUIRE(file.fileSize() == static_cast<long>(10000 * sizeof(int)));
+
+        MappedArray<int> reopened(file.path, MappingMode::ReadOnly);
+        REQUIRE(reopened.getSize() == 10000);
+        REQUIRE(reopened.get(1234) == 1234);
+    }
+
+    SECTION("Insert, remove and resize") {
+        MappedArray<double> array(file.path);
+        array.pushBack(1.0);
+        array.pushBack(3.0);
+        array.insertAt(1, 2.0);
+        array.insertAt(0, 0.0);
+        REQUIRE(array.getSize() == 4);
+        REQUIRE(array[1] == 1.0);
+        REQUIRE(array[2] == 2.0);
+
+        array.remove(0);
+        REQUIRE(array.get(0) == 1.0);
+        array.popBack();
+        REQUIRE(array.getSize() == 2);
+
+        array.resize(5);
+        REQUIRE(array.get(4) == 0.0);
+        array.set(4, 9.5);
+        array.flush();
+        REQUIRE(array.get(4) == 9.5);
+    }
+
+    SECTION("Move transfers the mapping") {
+        MappedArray<int> array(file.path);
+        array.pushBack(42);
+        MappedArray<int> moved(std::move(array));
+        REQUIRE(moved.get(0) == 42);
+        REQUIRE(array.getSize() == 0);
+    }
+
+    SECTION("Errors") {
+        MappedArray<int> array(file.path);
+        REQUIRE_THROWS_WITH(array.get(0), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(array.popBack(), Catch::Matchers::Contains("Empty array"));
+        REQUIRE_THROWS_WITH(MappedArray<int>("/nonexistent/dir/file", MappingMode::ReadOnly),
+                            Catch::Matchers::Contains("I/O error"));
+    }
+}
+
+TEST_CASE("MappedArray Read-Only Mapping", "[MappedArray]") {
+    TempFile file;
+    {
+        MappedArray<int> writer(file.path);
+        writer.pushBack(1);
+        writer.pushBack(2);
+        writer.pushBack(3);
+    }
+
+    MappedArray<int> reader(file.path, MappingMode::ReadOnly);
+    REQUIRE(reader.isReadOnly());
+    REQUIRE(reader.get(1) == 2);
+    REQUIRE_THROWS_WITH(reader.pushBack(3), Catch::Matchers::Contains("Immutable"));
+    REQUIRE_THROWS_WITH(reader.set(0, 5), Catch::Matchers::Contains("Immutable"));
+    REQUIRE_THROWS_WITH(reader.data(), Catch::Matchers::Contains("Immutable"));
+
+    SECTION("Size not a multiple of the element") {
+        REQUIRE_THROWS_WITH(MappedArray<double>(file.path, MappingMode::ReadOnly),
+                            Catch::Matchers::Contains("Invalid argument"));
+    }
+}
+
+TEST_CASE("MappedArraySequence Operations", "[MappedArraySequence]") {
+    TempFile file;
+    MappedArraySequence<int> sequence(file.path);
+    for (int i = 1; i <= 5; ++i)
+        sequence.append(i);
+
+    SECTION("Basic access") {
+        REQUIRE(sequence.getLength() == 5);
+        REQUIRE(sequence.getFirst() == 1);
+        REQUIRE(sequence.getLast() == 5);
+        sequence.prepend(0);
+        sequence.insertAt(10, 3);
+        sequence.remove(1);
+        REQUIRE(sequence.get(0) == 0);
+        REQUIRE(sequence.get(2) == 10);
+    }
+
+    SECTION("Functional operations") {
+        auto* mapped = sequence.map([](int x) { return x * x; });
+        auto* filtered = sequence.where([](int x) { return x % 2 == 1; });
+        REQUIRE(mapped->get(4) == 25);
+        REQUIRE(filtered->getLength() == 3);
+        REQUIRE(sequence.reduce([](int a, int b) { return a + b; }, 0) == 15);
+        delete mapped;
+        delete filtered;
+    }
+
+    SECTION("Derived sequences live on the heap") {
+        int raw[] = {6, 7};
+        MutableArraySequence<int> tail(raw, 2);
+        auto* joined = sequence.concat(&tail);
+        auto* sub = sequence.getSubsequence(1, 3);
+        auto* copy = sequence.clone();
+        auto* sliced = sequence.slice(3, 100);
+        REQUIRE(joined->getLength() == 7);
+        REQUIRE(joined->get(6) == 7);
+        REQUIRE(sub->get(0) == 2);
+        REQUIRE(sliced->getLength() == 2);
+
+        sequence[0] = 100;
+        REQUIRE(copy->get(0) == 1);
+        delete joined;
+        delete sub;
+        delete copy;
+        delete sliced;
+    }
+
+    SECTION("Read-only sequence") {
+        sequence.flush();
+        MappedArraySequence<int> reader(file.path, MappingMode::ReadOnly);
+        REQUIRE(reader.isReadOnly());
+        REQUIRE(reader.getLength() == 5);
+        REQUIRE(reader.reduce([](int a, int b) { return a + b; }, 0) == 15);
+        REQUIRE_THROWS_WITH(reader.append(6), Catch::Matchers::Contains("Immutable"));
+    }
+}
+
+#endif
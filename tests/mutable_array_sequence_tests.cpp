@@ -112,3 +112,73 @@ TEST_CASE("MutableArraySequence Edge Cases", "[MutableArraySequence]") {
         REQUIRE(single.getLength() == 0);
     }
 }
+
+TEST_CASE("MutableArraySequence Capacity", "[MutableArraySequence]") {
+    MutableArraySequence<int> seq;
+
+    SECTION("Append uses amortized growth") {
+        for (int i = 0; i < 100; ++i) {
+            seq.append(i);
+        }
+        REQUIRE(seq.getLength() == 100);
+        REQUIRE(seq.getCapacity() >= 100);
+        REQUIRE(seq.getLast() == 99);
+    }
+
+    SECTION("Reserve and shrink") {
+        seq.reserve(64);
+        REQUIRE(seq.getCapacity() == 64);
+        seq.append(1);
+        seq.append(2);
+        seq.shrinkToFit();
+        REQUIRE(seq.getCapacity() == 2);
+        REQUIRE(seq.getLength() == 2);
+    }
+}
+
+TEST_CASE("MutableArraySequence Inline Storage", "[MutableArraySequence]") {
+    SmallArraySequence<int, 8> seq;
+    for (int i = 0; i < 8; ++i)
+        seq.append(i);
+
+    SECTION("Stays within the inline buffer") {
+        REQUIRE(seq.getCapacity() == 8);
+        REQUIRE(seq.getLength() == 8);
+    }
+
+    SECTION("Operations return the same storage type") {
+        auto evens = std::unique_ptr<Sequence<int>>(seq.where([](int x) { return x % 2 == 0; }));
+        REQUIRE(evens->getLength() == 4);
+        auto combined = std::unique_ptr<Sequence<int>>(seq.concat(evens.get()));
+        REQUIRE(combined->getLength() == 12);
+        REQUIRE(combined->get(9) == 2);
+    }
+}
+
+TEST_CASE("MutableArraySequence Raw Data", "[MutableArraySequence]") {
+    int values[] = {5, 6, 7};
+    MutableArraySequence<int> seq(values, 3);
+
+    int* raw = seq.data();
+    raw[1] = 60;
+    REQUIRE(seq.get(1) == 60);
+    REQUIRE(seq.reduce([](int a, int b) { return a + b; }, 0) == 72);
+}
+
+TEST_CASE("MutableArraySequence Range Operations", "[MutableArraySequence]") {
+    MutableArraySequence<int> seq;
+    for (int i = 0; i < 1000; ++i)
+        seq.append(i);
+
+    int extra[] = {-1, -2};
+    seq.insertRange(500, extra, extra + 2);
+    REQUIRE(seq.getLength() == 1002);
+    REQUIRE(seq.get(501) == -2);
+
+    seq.eraseRange(500, 502);
+    REQUIRE(seq.get(500) == 500);
+
+    REQUIRE(seq.removeIf([](int x) { return x % 10 != 0; }) == 900);
+    REQUIRE(seq.getLength() == 100);
+    REQUIRE(seq.getLast() == 990);
+}
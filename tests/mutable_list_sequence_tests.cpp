@@ -131,3 +131,60 @@ TEST_CASE("MutableListSequence Edge Cases", "[MutableListSequence]") {
         REQUIRE(sliced->get(2) == 3);
     }
 }
+
+TEST_CASE("MutableListSequence Concat In Place", "[MutableListSequence]") {
+    int a[] = {1, 2};
+    int b[] = {3, 4, 5};
+    MutableListSequence<int> left(a, 2);
+    MutableListSequence<int> right(b, 3);
+
+    left.concatInPlace(std::move(right));
+    REQUIRE(left.getLength() == 5);
+    REQUIRE(left.getLast() == 5);
+    REQUIRE(right.getLength() == 0);
+
+    MutableListSequence<int> tail(b, 3);
+    left.append(std::move(tail));
+    REQUIRE(left.getLength() == 8);
+    REQUIRE(left.get(5) == 3);
+
+    UnrolledListSequence<int> unrolledLeft;
+    UnrolledListSequence<int> unrolledRight;
+    unrolledLeft.append(1);
+    unrolledRight.append(2);
+    unrolledLeft.concatInPlace(std::move(unrolledRight));
+    REQUIRE(unrolledLeft.getLength() == 2);
+    REQUIRE(unrolledLeft.get(1) == 2);
+}
+
+TEST_CASE("MutableListSequence Sort", "[MutableListSequence]") {
+    int items[] = {5, 3, 9, 1, 3};
+    MutableListSequence<int> seq(items, 5);
+
+    REQUIRE(seq.sort() == &seq);
+    REQUIRE(seq.getFirst() == 1);
+    REQUIRE(seq.get(2) == 3);
+    REQUIRE(seq.getLast() == 9);
+
+    seq.sort([](int a, int b) { return a > b; });
+    REQUIRE(seq.getFirst() == 9);
+    REQUIRE(seq.getLast() == 1);
+}
+
+TEST_CASE("MutableListSequence Bulk Operations", "[MutableListSequence]") {
+    int items[] = {1, 2, 3, 4, 5, 6};
+    MutableListSequence<int> seq(items, 6);
+
+    REQUIRE(seq.removeIf([](int x) { return x % 2 == 0; }) == 3);
+    REQUIRE(seq.getLength() == 3);
+    REQUIRE(seq.get(1) == 3);
+
+    int extra[] = {7, 8};
+    seq.insertRange(1, extra, extra + 2);
+    REQUIRE(seq.get(1) == 7);
+    REQUIRE(seq.get(3) == 3);
+
+    seq.removeRange(0, 2);
+    REQUIRE(seq.getLength() == 3);
+    REQUIRE(seq.getFirst() == 8);
+}
@@ -0,0 +1,139 @@
+#include "catch.hpp"
+#include "persistent_array_sequence.hpp"
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("PersistentArraySequence Basic Operations", "[PersistentArraySequence]") {
+    SECTION("Empty sequence") {
+        PersistentArraySequence<int> seq;
+        REQUIRE(seq.getLength() == 0);
+        REQUIRE_THROWS_WITH(seq.getFirst(), Catch::Matchers::Contains("Empty array"));
+        REQUIRE_THROWS_WITH(seq.remove(0), Catch::Matchers::Contains("Empty array"));
+    }
+
+    SECTION("Modifications return new versions") {
+        int data[] = {1, 2, 3};
+        PersistentArraySequence<int> seq(data, 3);
+        std::unique_ptr<Sequence<int>> appended(seq.append(4));
+        std::unique_ptr<Sequence<int>> prepended(seq.prepend(0));
+        std::unique_ptr<Sequence<int>> inserted(seq.insertAt(9, 1));
+        std::unique_ptr<Sequence<int>> removed(seq.remove(1));
+        std::unique_ptr<Sequence<int>> replaced(seq.set(2, 30));
+
+        REQUIRE(seq.getLength() == 3);
+        REQUIRE(seq.getLast() == 3);
+        REQUIRE(appended->getLast() == 4);
+        REQUIRE(prepended->getFirst() == 0);
+        REQUIRE(inserted->get(1) == 9);
+        REQUIRE(removed->get(1) == 3);
+        REQUIRE(replaced->get(2) == 30);
+        const PersistentArraySequence<int>& view = seq;
+        REQUIRE(view[2] == 3);
+        REQUIRE_THROWS_WITH(seq[0] = 5, Catch::Matchers::Contains("Immutable"));
+        REQUIRE_THROWS_WITH(seq.get(3), Catch::Matchers::Contains("Index out of range"));
+    }
+}
+
+TEST_CASE("PersistentArraySequence Versions Share Structure", "[PersistentArraySequence]") {
+    const int count = 40000;
+    std::vector<std::unique_ptr<Sequence<int>>> versions;
+    versions.emplace_back(new PersistentArraySequence<int>());
+    for (int i = 0; i < count; ++i)
+        versions.emplace_back(versions.back()->append(i));
+
+    // Каждая версия видит ровно свои элементы
+    for (int length : {0, 1, 31, 32, 33, 1024, 1056, 1057, 32768, 32800, count}) {
+        REQUIRE(versions[length]->getLength() == length);
+        if (length > 0) {
+            REQUIRE(versions[length]->getLast() == length - 1);
+            REQUIRE(versions[length]->get(length / 2) == length / 2);
+        }
+    }
+
+    auto* latest = static_cast<PersistentArraySequence<int>*>(versions.back().get());
+    std::unique_ptr<Sequence<int>> changed(latest->set(5000, -1));
+    REQUIRE(changed->get(5000) == -1);
+    REQUIRE(latest->get(5000) == 5000);
+    REQUIRE(versions[6000]->get(5000) == 5000);
+
+    std::unique_ptr<Sequence<int>> shrunk(latest->clone());
+    for (int i = count; i > 1000; --i) {
+        std::unique_ptr<Sequence<int>> next(shrunk->remove(i - 1));
+        shrunk = std::move(next);
+        REQUIRE(shrunk->getLast() == i - 2);
+    }
+    REQUIRE(shrunk->getLength() == 1000);
+    REQUIRE(latest->getLength() == count);
+    REQUIRE(latest->reduce([](int a, int b) { return a + b; }, 0) == count / 2 * (count - 1));
+
+    std::unique_ptr<Sequence<int>> regrown(shrunk->append(7));
+    REQUIRE(regrown->get(1000) == 7);
+    REQUIRE(latest->get(1000) == 1000);
+}
+
+TEST_CASE("PersistentArraySequence Matches Reference", "[PersistentArraySequence]") {
+    std::unique_ptr<Sequence<std::string>> seq(new PersistentArraySequence<std::string>());
+    std::vector<std::string> reference;
+    std::mt19937 random(17);
+
+    for (int step = 0; step < 600; ++step) {
+        int action = random() % 5;
+        Sequence<std::string>* next;
+        if (action < 3 || reference.empty()) {
+            next = seq->append(std::to_string(step));
+            reference.push_back(std::to_string(step));
+        } else if (action == 3) {
+            int index = random() % (reference.size() + 1);
+            next = seq->insertAt("i" + std::to_string(step), index);
+            reference.insert(reference.begin() + index, "i" + std::to_string(step));
+        } else {
+            int index = random() % reference.size();
+            next = seq->remove(index);
+            reference.erase(reference.begin() + index);
+        }
+        seq.reset(next);
+    }
+
+    REQUIRE(seq->getLength() == static_cast<int>(reference.size()));
+    for (int i = 0; i < seq->getLength(); ++i)
+        REQUIRE(seq->get(i) == reference[i]);
+}
+
+TEST_CASE("PersistentArraySequence Functional Operations", "[PersistentArraySequence]") {
+    std::vector<int> values(100);
+    for (int i = 0; i < 100; ++i) values[i] = i;
+    PersistentArraySequence<int> seq(values.data(), 100);
+
+    std::unique_ptr<Sequence<int>> mapped(seq.map([](int x) { return x * 2; }));
+    REQUIRE(mapped->get(99) == 198);
+    std::unique_ptr<Sequence<int>> even(seq.where([](int x) { return x % 2 == 0; }));
+    REQUIRE(even->getLength() == 50);
+    std::unique_ptr<Sequence<int>> joined(seq.concat(even.get()));
+    REQUIRE(joined->getLength() == 150);
+    REQUIRE(joined->getLast() == 98);
+    std::unique_ptr<Sequence<int>> zipped(seq.zip(even.get(), [](int a, int b) { return a + b; }));
+    REQUIRE(zipped->getLength() == 50);
+    REQUIRE(zipped->get(49) == 49 + 98);
+    std::unique_ptr<Sequence<int>> sub(seq.getSubsequence(30, 70));
+    REQUIRE(sub->getLength() == 41);
+    REQUIRE(sub->getFirst() == 30);
+    std::unique_ptr<Sequence<int>> sliced(seq.slice(90, 200));
+    REQUIRE(sliced->getLength() == 10);
+}
+
+TEST_CASE("PersistentArraySequence Throwing Callbacks", "[PersistentArraySequence]") {
+    std::string items[] = {"a", "b", "c", "d"};
+    PersistentArraySequence<std::string> seq(items, 4);
+
+    auto failOnC = [](const std::string& s) {
+        if (s == "c") throw std::runtime_error("callback failed");
+        return s;
+    };
+    REQUIRE_THROWS_WITH(seq.map(failOnC), "callback failed");
+    REQUIRE_THROWS_WITH(seq.where([&](std::string s) { return !failOnC(s).empty(); }), "callback failed");
+    REQUIRE_THROWS_WITH(seq.zip(&seq, [&](std::string a, std::string) { return failOnC(a); }), "callback failed");
+    REQUIRE(seq.getLength() == 4);
+}
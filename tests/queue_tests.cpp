@@ -177,4 +177,65 @@ TEST_CASE("Queue Edge Cases", "[Queue]") {
         REQUIRE(q.isEmpty());
         REQUIRE(q.size() == 0);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Queue Move Semantics", "[Queue]") {
+    Queue<std::string> queue;
+    std::string payload(1000, 'q');
+    queue.enqueue(std::move(payload));
+    queue.emplace(3, 'z');
+    REQUIRE(queue.size() == 2);
+    REQUIRE(queue.dequeue().size() == 1000);
+    REQUIRE(queue.front() == "zzz");
+}
+
+TEST_CASE("Queue Concat In Place", "[Queue]") {
+    Queue<int> merged;
+    for (int worker = 0; worker < 4; ++worker) {
+        Queue<int> results;
+        for (int i = 0; i < 10; ++i)
+            results.enqueue(worker * 10 + i);
+        merged.concatInPlace(std::move(results));
+        REQUIRE(results.isEmpty());
+    }
+    REQUIRE(merged.size() == 40);
+    for (int i = 0; i < 40; ++i)
+        REQUIRE(merged.dequeue() == i);
+
+    Queue<int> left, right;
+    left.enqueue(1);
+    right.enqueue(2);
+    Queue<int> joined = left.concat(std::move(right));
+    REQUIRE(joined.size() == 2);
+    REQUIRE(left.size() == 1);
+    REQUIRE(right.isEmpty());
+}
+
+TEST_CASE("Queue Sort", "[Queue]") {
+    Queue<std::string> queue;
+    for (const char* word : {"ccc", "a", "bb", "d"})
+        queue.enqueue(word);
+
+    queue.sort([](const std::string& a, const std::string& b) {
+        return a.size() < b.size();
+    });
+    REQUIRE(queue.dequeue() == "a");
+    REQUIRE(queue.dequeue() == "d");
+    REQUIRE(queue.dequeue() == "bb");
+    queue.sort();
+    REQUIRE(queue.front() == "ccc");
+}
+
+TEST_CASE("Queue Bulk Operations", "[Queue]") {
+    Queue<int> queue;
+    for (int i = 0; i < 10; ++i)
+        queue.enqueue(i);
+
+    REQUIRE(queue.removeIf([](int x) { return x % 3 == 0; }) == 4);
+    queue.removeRange(0, 1);
+    int extra[] = {100};
+    queue.insertRange(0, extra, extra + 1);
+    REQUIRE(queue.size() == 6);
+    REQUIRE(queue.dequeue() == 100);
+    REQUIRE(queue.dequeue() == 2);
+}
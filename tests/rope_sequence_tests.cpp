@@ -0,0 +1,164 @@
+#include "catch.hpp"
+#include "rope_sequence.hpp"
+#include "mutable_array_sequence.hpp"
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("RopeSequence Basic Operations", "[RopeSequence]") {
+    SECTION("Empty sequence") {
+        RopeSequence<int> seq;
+        REQUIRE(seq.getLength() == 0);
+        REQUIRE_THROWS_WITH(seq.getFirst(), Catch::Matchers::Contains("Empty array"));
+        REQUIRE_THROWS_WITH(seq.remove(0), Catch::Matchers::Contains("Empty array"));
+    }
+
+    SECTION("Both ends and the middle") {
+        int items[] = {2, 3, 5};
+        RopeSequence<int> seq(items, 3);
+        seq.insertAt(4, 2);
+        seq.prepend(1);
+        seq.prepend(0);
+        seq.append(6);
+
+        REQUIRE(seq.getLength() == 7);
+        for (int i = 0; i < 7; ++i)
+            REQUIRE(seq.get(i) == i);
+        REQUIRE(seq.getFirst() == 0);
+        REQUIRE(seq.getLast() == 6);
+
+        seq[3] = 30;
+        REQUIRE(seq.get(3) == 30);
+        seq.remove(3);
+        seq.remove(0);
+        REQUIRE(seq.getFirst() == 1);
+        REQUIRE(seq.get(2) == 4);
+    }
+
+    SECTION("Invalid indices") {
+        RopeSequence<int> seq;
+        seq.append(1);
+        REQUIRE_THROWS_WITH(seq.get(1), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(seq.insertAt(0, 2), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(seq.remove(-1), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(seq.getSubsequence(0, 1), Catch::Matchers::Contains("Invalid indices"));
+    }
+}
+
+TEST_CASE("RopeSequence Matches Reference", "[RopeSequence]") {
+    RopeSequence<std::string> seq;
+    std::vector<std::string> reference;
+    std::mt19937 random(7);
+
+    for (int step = 0; step < 6000; ++step) {
+        int action = random() % 6;
+        if (action < 3 || reference.empty()) {
+            int index = action == 0 ? 0 : action == 1 ? reference.size() : random() % (reference.size() + 1);
+            std::string value = std::to_string(step);
+            seq.insertAt(value, index);
+            reference.insert(reference.begin() + index, value);
+        } else if (action < 5) {
+            int index = random() % reference.size();
+            seq.remove(index);
+            reference.erase(reference.begin() + index);
+        } else {
+            int index = random() % reference.size();
+            seq[index] = "set" + std::to_string(step);
+            reference[index] = "set" + std::to_string(step);
+        }
+        if (!reference.empty()) {
+            int probe = random() % reference.size();
+            REQUIRE(seq.get(probe) == reference[probe]);
+            REQUIRE(seq.getFirst() == reference.front());
+            REQUIRE(seq.getLast() == reference.back());
+        }
+    }
+
+    REQUIRE(seq.getLength() == static_cast<int>(reference.size()));
+    for (int i = 0; i < seq.getLength(); ++i)
+        REQUIRE(seq.get(i) == reference[i]);
+}
+
+TEST_CASE("RopeSequence Concat And Split", "[RopeSequence]") {
+    SECTION("Thousands of fragments") {
+        std::unique_ptr<Sequence<int>> log(new RopeSequence<int>());
+        int next = 0;
+        for (int fragment = 0; fragment < 5000; ++fragment) {
+            RopeSequence<int> piece;
+            for (int i = 0; i < fragment % 7 + 1; ++i)
+                piece.append(next++);
+            log.reset(log->concat(&piece));
+        }
+        REQUIRE(log->getLength() == next);
+        for (int i = 0; i < next; i += 97)
+            REQUIRE(log->get(i) == i);
+        REQUIRE(log->getLast() == next - 1);
+        long long sum = log->reduce([](int a, int b) { return a + b; }, 0);
+        REQUIRE(sum == static_cast<long long>(next) * (next - 1) / 2);
+    }
+
+    SECTION("Operands stay unchanged") {
+        int left[] = {1, 2, 3};
+        int right[] = {4, 5};
+        RopeSequence<int> a(left, 3);
+        RopeSequence<int> b(right, 2);
+        std::unique_ptr<Sequence<int>> joined(a.concat(&b));
+        (*joined)[0] = 10;
+        (*joined)[4] = 50;
+        REQUIRE(a.get(0) == 1);
+        REQUIRE(b.get(1) == 5);
+        REQUIRE(joined->get(0) == 10);
+        REQUIRE(joined->getLast() == 50);
+    }
+
+    SECTION("Subsequences and other sequence types") {
+        std::vector<int> values(1000);
+        for (int i = 0; i < 1000; ++i)
+            values[i] = i;
+        RopeSequence<int> seq(values.data(), 1000);
+        seq.prepend(-1);
+        seq.append(1000);
+
+        std::unique_ptr<Sequence<int>> middle(seq.getSubsequence(100, 899));
+        REQUIRE(middle->getLength() == 800);
+        REQUIRE(middle->getFirst() == 99);
+        REQUIRE(middle->getLast() == 898);
+        std::unique_ptr<Sequence<int>> edges(seq.slice(0, 2));
+        REQUIRE(edges->get(1) == 0);
+
+        int extra[] = {7, 8};
+        MutableArraySequence<int> array(extra, 2);
+        std::unique_ptr<Sequence<int>> mixed(middle->concat(&array));
+        REQUIRE(mixed->getLength() == 802);
+        REQUIRE(mixed->getLast() == 8);
+    }
+
+    SECTION("Clone shares until written") {
+        int items[] = {1, 2, 3};
+        RopeSequence<int> seq(items, 3);
+        std::unique_ptr<Sequence<int>> copy(seq.clone());
+        (*copy)[1] = 20;
+        REQUIRE(seq.get(1) == 2);
+        REQUIRE(copy->get(1) == 20);
+        std::unique_ptr<Sequence<int>> doubled(seq.map([](int x) { return x * 2; }));
+        std::unique_ptr<Sequence<int>> zipped(seq.zip(copy.get(), [](int x, int y) { return x + y; }));
+        REQUIRE(doubled->getLast() == 6);
+        REQUIRE(zipped->get(1) == 22);
+    }
+}
+
+TEST_CASE("RopeSequence Throwing Callbacks", "[RopeSequence]") {
+    std::string items[] = {"a", "b", "c", "d"};
+    RopeSequence<std::string> seq(items, 4);
+
+    auto failOnC = [](const std::string& s) {
+        if (s == "c") throw std::runtime_error("callback failed");
+        return s;
+    };
+    REQUIRE_THROWS_WITH(seq.map(failOnC), "callback failed");
+    REQUIRE_THROWS_WITH(seq.where([&](std::string s) { return !failOnC(s).empty(); }), "callback failed");
+    REQUIRE_THROWS_WITH(seq.zip(&seq, [&](std::string a, std::string) { return failOnC(a); }), "callback failed");
+    REQUIRE(seq.getLength() == 4);
+}
@@ -0,0 +1,135 @@
+#include "catch.hpp"
+#include "sequence_view.hpp"
+#include "immutable_array_sequence.hpp"
+#include "mutable_array_sequence.hpp"
+#include "arena_allocator.hpp"
+#include <memory>
+#include <string>
+
+TEST_CASE("SequenceView Over Immutable Array", "[SequenceView]") {
+    int values[] = {10, 20, 30, 40, 50};
+    ImmutableArraySequence<int> seq(values, 5);
+
+    SECTION("Subsequence is a window over the same buffer") {
+        auto sub = std::unique_ptr<Sequence<int>>(seq.getSubsequence(1, 3));
+        auto* view = dynamic_cast<SequenceView<int>*>(sub.get());
+        REQUIRE(view != nullptr);
+        REQUIRE(view->isOwning());
+        REQUIRE(view->data() == seq.data() + 1);
+        REQUIRE(view->getLength() == 3);
+        REQUIRE(view->getFirst() == 20);
+        REQUIRE(view->getLast() == 40);
+
+        auto inner = std::unique_ptr<Sequence<int>>(view->slice(1, 3));
+        REQUIRE(dynamic_cast<SequenceView<int>*>(inner.get())->data() == seq.data() + 2);
+        REQUIRE(inner->get(1) == 40);
+    }
+
+    SECTION("View keeps the buffer alive") {
+        std::unique_ptr<Sequence<int>> sub;
+        {
+            ImmutableArraySequence<int> temporary(values, 5);
+            sub.reset(temporary.slice(3, 5));
+        }
+        REQUIRE(sub->getLength() == 2);
+        REQUIRE(sub->get(0) == 40);
+        REQUIRE(sub->reduce([](int a, int b) { return a + b; }, 0) == 90);
+    }
+
+    SECTION("Modifications return new owning views") {
+        auto sub = std::unique_ptr<Sequence<int>>(seq.getSubsequence(1, 3));
+        auto appended = std::unique_ptr<Sequence<int>>(sub->append(60));
+        auto inserted = std::unique_ptr<Sequence<int>>(sub->insertAt(25, 1));
+        auto removed = std::unique_ptr<Sequence<int>>(sub->remove(0));
+
+        REQUIRE(sub->getLength() == 3);
+        REQUIRE(appended->getLength() == 4);
+        REQUIRE(appended->getLast() == 60);
+        REQUIRE(inserted->get(1) == 25);
+        REQUIRE(inserted->get(2) == 30);
+        REQUIRE(removed->getFirst() == 30);
+        REQUIRE(dynamic_cast<SequenceView<int>*>(appended.get())->data() != seq.data() + 1);
+        REQUIRE_THROWS((*sub)[0]);
+    }
+
+    SECTION("Views concatenate with arrays") {
+        auto sub = std::unique_ptr<Sequence<int>>(seq.getSubsequence(0, 1));
+        auto joined = std::unique_ptr<Sequence<int>>(seq.concat(sub.get()));
+        REQUIRE(joined->getLength() == 7);
+        REQUIRE(joined->getLast() == 20);
+        auto reversed = std::unique_ptr<Sequence<int>>(sub->concat(&seq));
+        REQUIRE(reversed->getLength() == 7);
+        REQUIRE(reversed->get(2) == 10);
+    }
+
+    SECTION("Errors") {
+        auto sub = std::unique_ptr<Sequence<int>>(seq.getSubsequence(1, 2));
+        REQUIRE_THROWS_WITH(sub->get(2), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(sub->getSubsequence(1, 0), Catch::Matchers::Contains("Invalid indices"));
+        auto empty = std::unique_ptr<Sequence<int>>(sub->slice(2, 2));
+        REQUIRE_THROWS(empty->getFirst());
+    }
+}
+
+TEST_CASE("SequenceView Over Mutable Array", "[SequenceView]") {
+    std::string values[] = {"a", "b", "c", "d"};
+    MutableArraySequence<std::string> seq(values, 4);
+
+    SequenceView<std::string> view = seq.view(1, 2);
+    REQUIRE_FALSE(view.isOwning());
+    REQUIRE(view.data() == seq.data() + 1);
+    REQUIRE(view.get(0) == "b");
+
+    seq[2] = "x";
+    REQUIRE(view.getLast() == "x");
+
+    auto mapped = std::unique_ptr<Sequence<std::string>>(view.map([](std::string s) { return s + s; }));
+    auto filtered = std::unique_ptr<Sequence<std::string>>(view.where([](std::string s) { return s == "x"; }));
+    REQUIRE(mapped->get(1) == "xx");
+    REQUIRE(filtered->getLength() == 1);
+
+    auto sub = std::unique_ptr<Sequence<std::string>>(seq.getSubsequence(1, 2));
+    seq[1] = "y";
+    REQUIRE(sub->get(0) == "b");
+    REQUIRE_THROWS(seq.view(2, 4));
+}
+
+TEST_CASE("SequenceView Keeps The Source Allocator", "[SequenceView]") {
+    MonotonicArena arena;
+    ArenaAllocator<int> allocator(arena);
+    using Storage = DynamicArray<int, ArenaAllocator<int>>;
+    using View = SequenceView<int, ArenaAllocator<int>>;
+
+    Storage buffer(allocator);
+    for (int i = 0; i < 6; ++i)
+        buffer.pushBack(i);
+    ImmutableArraySequence<int, Storage> seq(std::move(buffer));
+
+    auto sub = std::unique_ptr<Sequence<int>>(seq.getSubsequence(1, 4));
+    auto* view = dynamic_cast<View*>(sub.get());
+    REQUIRE(view != nullptr);
+    REQUIRE(view->getAllocator() == allocator);
+
+    std::size_t before = arena.getBytesAllocated();
+    auto mapped = std::unique_ptr<Sequence<int>>(view->map([](int x) { return x * 10; }));
+    auto filtered = std::unique_ptr<Sequence<int>>(view->where([](int x) { return x % 2 == 0; }));
+    auto zipped = std::unique_ptr<Sequence<int>>(view->zip(&seq, [](int a, int b) { return a + b; }));
+    auto appended = std::unique_ptr<Sequence<int>>(view->append(7));
+    auto empty = std::unique_ptr<Sequence<int>>(view->slice(2, 2));
+    REQUIRE(arena.getBytesAllocated() > before);
+
+    for (Sequence<int>* derived : {mapped.get(), filtered.get(), zipped.get(), appended.get(), empty.get()})
+        REQUIRE(dynamic_cast<View*>(derived)->getAllocator() == allocator);
+    REQUIRE(mapped->get(3) == 40);
+    REQUIRE(filtered->getLength() == 2);
+    REQUIRE(zipped->get(1) == 3);
+    REQUIRE(appended->getLast() == 7);
+
+    auto joined = std::unique_ptr<Sequence<int>>(seq.concat(view));
+    REQUIRE(joined->getLength() == 10);
+    REQUIRE(dynamic_cast<ImmutableArraySequence<int, Storage>*>(joined.get())->getAllocator() == allocator);
+
+    MutableArraySequence<int, Storage> mutableSeq{Storage(allocator)};
+    mutableSeq.append(1);
+    REQUIRE(mutableSeq.view(0, 0).getAllocator() == allocator);
+}
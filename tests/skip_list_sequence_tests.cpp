@@ -0,0 +1,125 @@
+#include "catch.hpp"
+#include "skip_list_sequence.hpp"
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("SkipListSequence Basic Operations", "[SkipListSequence]") {
+    SECTION("Empty sequence") {
+        SkipListSequence<int> seq;
+        REQUIRE(seq.getLength() == 0);
+        REQUIRE_THROWS_WITH(seq.getFirst(), Catch::Matchers::Contains("Empty list"));
+        REQUIRE_THROWS_WITH(seq.remove(0), Catch::Matchers::Contains("Empty list"));
+    }
+
+    SECTION("Insert and access") {
+        int items[] = {1, 2, 4};
+        SkipListSequence<int> seq(items, 3);
+        seq.insertAt(3, 2);
+        seq.prepend(0);
+        seq.append(5);
+
+        REQUIRE(seq.getLength() == 6);
+        for (int i = 0; i < 6; ++i)
+            REQUIRE(seq.get(i) == i);
+        REQUIRE(seq.getFirst() == 0);
+        REQUIRE(seq.getLast() == 5);
+
+        seq[3] = 30;
+        REQUIRE(seq.get(3) == 30);
+        seq.remove(3);
+        REQUIRE(seq.get(3) == 4);
+    }
+
+    SECTION("Invalid indices") {
+        SkipListSequence<int> seq;
+        seq.append(1);
+        REQUIRE_THROWS_WITH(seq.get(1), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(seq.insertAt(0, 2), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(seq.remove(-1), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(seq.getSubsequence(0, 1), Catch::Matchers::Contains("Invalid indices"));
+    }
+}
+
+TEST_CASE("SkipListSequence Matches Reference", "[SkipListSequence]") {
+    SkipListSequence<std::string> seq;
+    std::vector<std::string> reference;
+    std::mt19937 random(42);
+
+    for (int step = 0; step < 5000; ++step) {
+        int action = random() % 4;
+        if (action < 2 || reference.empty()) {
+            int index = random() % (reference.size() + 1);
+            std::string value = std::to_string(step);
+            seq.insertAt(value, index);
+            reference.insert(reference.begin() + index, value);
+        } else {
+            int index = random() % reference.size();
+            seq.remove(index);
+            reference.erase(reference.begin() + index);
+        }
+        if (!reference.empty()) {
+            int probe = random() % reference.size();
+            REQUIRE(seq.get(probe) == reference[probe]);
+        }
+    }
+
+    REQUIRE(seq.getLength() == static_cast<int>(reference.size()));
+    for (int i = 0; i < seq.getLength(); ++i)
+        REQUIRE(seq[i] == reference[i]);
+
+    while (seq.getLength() > 0)
+        seq.remove(seq.getLength() / 2);
+    seq.append("again");
+    REQUIRE(seq.getFirst() == "again");
+}
+
+TEST_CASE("SkipListSequence Functional Operations", "[SkipListSequence]") {
+    int items[] = {1, 2, 3, 4, 5};
+    SkipListSequence<int> seq(items, 5);
+
+    std::unique_ptr<Sequence<int>> mapped(seq.map([](int x) { return x * 10; }));
+    REQUIRE(mapped->get(4) == 50);
+
+    std::unique_ptr<Sequence<int>> even(seq.where([](int x) { return x % 2 == 0; }));
+    REQUIRE(even->getLength() == 2);
+    REQUIRE(seq.reduce([](int a, int b) { return a + b; }, 0) == 15);
+
+    std::unique_ptr<Sequence<int>> joined(seq.concat(even.get()));
+    REQUIRE(joined->getLength() == 7);
+    REQUIRE(joined->getLast() == 4);
+
+    std::unique_ptr<Sequence<int>> zipped(seq.zip(even.get(), [](int a, int b) { return a + b; }));
+    REQUIRE(zipped->getLength() == 2);
+    REQUIRE(zipped->get(1) == 6);
+
+    std::unique_ptr<Sequence<int>> sub(seq.getSubsequence(1, 3));
+    REQUIRE(sub->getLength() == 3);
+    REQUIRE(sub->get(0) == 2);
+    std::unique_ptr<Sequence<int>> sliced(seq.slice(3, 10));
+    REQUIRE(sliced->getLength() == 2);
+
+    SkipListSequence<int> copy(seq);
+    copy.remove(0);
+    REQUIRE(seq.getLength() == 5);
+    SkipListSequence<int> moved(std::move(copy));
+    REQUIRE(moved.getFirst() == 2);
+    REQUIRE(copy.getLength() == 0);
+    copy = moved;
+    REQUIRE(copy.getLength() == 4);
+}
+
+TEST_CASE("SkipListSequence Throwing Callbacks", "[SkipListSequence]") {
+    std::string items[] = {"a", "b", "c", "d"};
+    SkipListSequence<std::string> seq(items, 4);
+
+    auto failOnC = [](const std::string& s) {
+        if (s == "c") throw std::runtime_error("callback failed");
+        return s;
+    };
+    REQUIRE_THROWS_WITH(seq.map(failOnC), "callback failed");
+    REQUIRE_THROWS_WITH(seq.where([&](std::string s) { return !failOnC(s).empty(); }), "callback failed");
+    REQUIRE_THROWS_WITH(seq.zip(&seq, [&](std::string a, std::string) { return failOnC(a); }), "callback failed");
+    REQUIRE(seq.getLength() == 4);
+}
@@ -202,4 +202,42 @@ TEST_CASE("Stack Order Preservation", "[Stack]") {
         s.pop();
         REQUIRE(s.top() == "first");
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Stack Drain", "[Stack]") {
+    Stack<int> stack;
+    for (int i = 0; i < 100000; ++i)
+        stack.push(i);
+    long long sum = 0;
+    while (!stack.isEmpty())
+        sum += stack.pop();
+    REQUIRE(sum == 4999950000LL);
+}
+
+TEST_CASE("Stack Sort", "[Stack]") {
+    Stack<int> s;
+    for (int item : {4, 1, 3, 2})
+        s.push(item);
+
+    s.sort();
+    REQUIRE(s.top() == 4);
+    s.sort([](const int& a, const int& b) { return a > b; });
+    REQUIRE(s.pop() == 1);
+    REQUIRE(s.pop() == 2);
+}
+
+TEST_CASE("Stack Bulk Operations", "[Stack]") {
+    Stack<int> s;
+    for (int i = 0; i < 10; ++i)
+        s.push(i);
+
+    REQUIRE(s.removeIf([](int x) { return x > 6; }) == 3);
+    REQUIRE(s.top() == 6);
+    s.removeRange(0, 5);
+    REQUIRE(s.size() == 2);
+    int extra[] = {42, 43};
+    s.insertRange(s.size(), extra, extra + 2);
+    REQUIRE(s.pop() == 43);
+    REQUIRE(s.pop() == 42);
+    REQUIRE(s.pop() == 6);
+}
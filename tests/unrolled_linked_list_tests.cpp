@@ -0,0 +1,379 @@
+#include "catch.hpp"
+#include "unrolled_linked_list.hpp"
+#include "mutable_list_sequence.hpp"
+#include "immutable_list_sequence.hpp"
+#include "stack.hpp"
+#include "queue.hpp"
+#include "deque.hpp"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("UnrolledLinkedList Basic Operations", "[UnrolledLinkedList]") {
+    int init[] = {1, 2, 3, 4, 5};
+    UnrolledLinkedList<int, std::allocator<int>, 4> list(init, 5);
+
+    SECTION("Access") {
+        REQUIRE(list.getLength() == 5);
+        REQUIRE(list.getFirst() == 1);
+        REQUIRE(list.getLast() == 5);
+        REQUIRE(list.get(4) == 5);
+        list[2] = 30;
+        REQUIRE(list[2] == 30);
+    }
+
+    SECTION("Insert splits full nodes") {
+        list.insertAt(10, 1);
+        list.insertAt(20, 3);
+        list.prepend(0);
+        int expected[] = {0, 1, 10, 2, 20, 3, 4, 5};
+        REQUIRE(list == UnrolledLinkedList<int, std::allocator<int>, 4>(expected, 8));
+    }
+
+    SECTION("Remove merges sparse nodes") {
+        for (int i = 0; i < 4; ++i)
+            list.remove(0);
+        REQUIRE(list.getLength() == 1);
+        REQUIRE(list.getFirst() == 5);
+        list.remove(0);
+        REQUIRE(list.getLength() == 0);
+        REQUIRE(list.getPoolStats().used == 0);
+        REQUIRE_THROWS_WITH(list.getFirst(), Catch::Matchers::Contains("Empty list"));
+    }
+
+    SECTION("Sublists, copies and concat") {
+        auto* sub = list.getSubList(1, 3);
+        REQUIRE(sub->getLength() == 3);
+        REQUIRE(sub->get(0) == 2);
+        auto* joined = list.concat(sub);
+        REQUIRE(joined->getLength() == 8);
+        REQUIRE(joined->getLast() == 4);
+        auto* copy = list.clone();
+        REQUIRE(*copy == list);
+        delete sub;
+        delete joined;
+        delete copy;
+    }
+
+    SECTION("Errors") {
+        REQUIRE_THROWS_WITH(list.get(5), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(list.insertAt(0, 7), Catch::Matchers::Contains("Index out of range"));
+        REQUIRE_THROWS_WITH(list.getSubList(3, 1), Catch::Matchers::Contains("Invalid indices"));
+    }
+}
+
+TEST_CASE("UnrolledLinkedList Matches Reference", "[UnrolledLinkedList]") {
+    UnrolledLinkedList<std::string, std::allocator<std::string>, 4> list;
+    std::vector<std::string> reference;
+    std::mt19937 random(42);
+
+    for (int step = 0; step < 3000; ++step) {
+        int action = random() % 4;
+        if (action < 2 || reference.empty()) {
+            int index = random() % (reference.size() + 1);
+            std::string value = std::to_string(step);
+            list.insertAt(value, index);
+            reference.insert(reference.begin() + index, value);
+        } else {
+            int index = random() % reference.size();
+            list.remove(index);
+            reference.erase(reference.begin() + index);
+        }
+        if (!reference.empty()) {
+            int probe = random() % reference.size();
+            REQUIRE(list.get(probe) == reference[probe]);
+        }
+    }
+
+    REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+    REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+    PoolStats stats = list.getPoolStats();
+    REQUIRE(stats.used * 4 >= list.getLength());
+}
+
+TEST_CASE("UnrolledLinkedList As Sequence Backing", "[UnrolledLinkedList]") {
+    UnrolledListSequence<int> sequence;
+    for (int i = 0; i < 1000; ++i)
+        sequence.append(i);
+
+    auto* doubled = sequence.map([](int x) { return x * 2; });
+    auto* odd = sequence.where([](int x) { return x % 2 == 1; });
+    REQUIRE(doubled->get(999) == 1998);
+    REQUIRE(odd->getLength() == 500);
+    REQUIRE(sequence.reduce([](int a, int b) { return a + b; }, 0) == 499500);
+    delete doubled;
+    delete odd;
+
+    ImmutableListSequence<int, UnrolledLinkedList<int>> immutable;
+    auto* appended = immutable.append(1);
+    REQUIRE(appended->getLength() == 1);
+    REQUIRE(immutable.getLength() == 0);
+    delete appended;
+
+    Stack<int, UnrolledLinkedList<int>> stack;
+    Queue<int, UnrolledLinkedList<int>> queue;
+    for (int i = 0; i < 100; ++i) {
+        stack.push(i);
+        queue.enqueue(i);
+    }
+    REQUIRE(stack.pop() == 99);
+    REQUIRE(queue.dequeue() == 0);
+    REQUIRE(queue.front() == 1);
+}
+
+TEST_CASE("UnrolledLinkedList Sort", "[UnrolledLinkedList]") {
+    std::mt19937 rng(11);
+    UnrolledLinkedList<int, std::allocator<int>, 4> list;
+    std::vector<int> reference;
+    for (int i = 0; i < 500; ++i) {
+        int value = static_cast<int>(rng() % 100);
+        list.insertAt(value, static_cast<int>(rng() % (list.getLength() + 1)));
+    }
+    for (int item : list)
+        reference.push_back(item);
+    int nodes = list.getPoolStats().used;
+
+    list.sort(std::greater<>());
+    std::sort(reference.begin(), reference.end(), std::greater<>());
+    REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+    REQUIRE(list.getPoolStats().used == nodes);
+}
+
+TEST_CASE("UnrolledLinkedList Compact", "[UnrolledLinkedList]") {
+    UnrolledLinkedList<std::string, std::allocator<std::string>, 4> list;
+    std::vector<std::string> reference;
+    std::mt19937 random(5);
+    for (int step = 0; step < 400; ++step) {
+        int index = random() % (reference.size() + 1);
+        list.insertAt(std::to_string(step), index);
+        reference.insert(reference.begin() + index, std::to_string(step));
+    }
+
+    list.compact();
+    REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+    REQUIRE(list.getPoolStats().used == 100);
+    REQUIRE(list.getPoolStats().slabs == 1);
+    list.insertAt("mid", 200);
+    REQUIRE(list.get(200) == "mid");
+}
+
+TEST_CASE("UnrolledLinkedList Removes From The Back", "[UnrolledLinkedList]") {
+    // С поиском предшественника от головы такой цикл был бы квадратичным
+    const int count = 300000;
+    UnrolledLinkedList<int, std::allocator<int>, 8> list;
+    Stack<int, UnrolledLinkedList<int>> stack;
+    for (int i = 0; i < count; ++i) {
+        list.append(i);
+        stack.push(i);
+    }
+
+    bool ordered = true;
+    for (int i = count - 1; i >= 0; --i) {
+        ordered = ordered && list.getLast() == i;
+        list.remove(i);
+        ordered = ordered && stack.pop() == i;
+    }
+    REQUIRE(ordered);
+    REQUIRE(list.getLength() == 0);
+    REQUIRE(list.getPoolStats().used == 0);
+    REQUIRE(stack.isEmpty());
+
+    int items[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    UnrolledLinkedList<int, std::allocator<int>, 4> small(items, 9);
+    small.remove(8);
+    small.remove(4);
+    small.remove(6);
+    int expected[] = {1, 2, 3, 4, 6, 7};
+    REQUIRE(small == UnrolledLinkedList<int, std::allocator<int>, 4>(expected, 6));
+    small.append(10);
+    REQUIRE(small.getLast() == 10);
+}
+
+TEST_CASE("UnrolledLinkedList Bulk Operations", "[UnrolledLinkedList]") {
+    UnrolledLinkedList<std::string, std::allocator<std::string>, 4> list;
+    std::vector<std::string> reference;
+    for (int i = 0; i < 20; ++i) {
+        list.append(std::to_string(i));
+        reference.push_back(std::to_string(i));
+    }
+
+    SECTION("insertRange") {
+        std::vector<std::string> extra = {"a", "b", "c", "d", "e", "f"};
+        list.insertRange(5, extra.begin(), extra.end());
+        reference.insert(reference.begin() + 5, extra.begin(), extra.end());
+        list.insertRange(0, extra.begin(), extra.begin() + 1);
+        reference.insert(reference.begin(), "a");
+        list.insertRange(4, extra.begin(), extra.begin() + 2);
+        reference.insert(reference.begin() + 4, extra.begin(), extra.begin() + 2);
+        list.insertRange(list.getLength(), extra.begin(), extra.end());
+        reference.insert(reference.end(), extra.begin(), extra.end());
+        list.insertRange(3, extra.end(), extra.end());
+
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+        REQUIRE(list.get(6) == reference[6]);
+        REQUIRE(list.getLast() == "f");
+
+        // Диапазон из самого списка
+        list.insertRange(1, list.begin(), list.end());
+        REQUIRE(list.getLength() == 2 * static_cast<int>(reference.size()));
+        REQUIRE(list.get(1) == reference[0]);
+        REQUIRE(list.getLast() == "f");
+        REQUIRE_THROWS_WITH(list.insertRange(-1, extra.begin(), extra.end()),
+                            Catch::Matchers::Contains("Index out of range"));
+    }
+
+    SECTION("removeRange") {
+        list.removeRange(3, 13);
+        reference.erase(reference.begin() + 3, reference.begin() + 13);
+        list.removeRange(0, 2);
+        reference.erase(reference.begin(), reference.begin() + 2);
+        list.removeRange(list.getLength() - 1, list.getLength());
+        reference.pop_back();
+        list.removeRange(4, 4);
+
+        REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        REQUIRE(list.getLast() == reference.back());
+        REQUIRE(list.get(2) == reference[2]);
+        REQUIRE_THROWS_WITH(list.removeRange(3, 1), Catch::Matchers::Contains("Invalid indices"));
+
+        list.removeRange(0, list.getLength());
+        REQUIRE(list.getLength() == 0);
+        REQUIRE(list.getPoolStats().slabs == 0);
+    }
+
+    SECTION("removeIf") {
+        int removed = list.removeIf([](const std::string& s) { return s.size() == 1; });
+        REQUIRE(removed == 10);
+        REQUIRE(list.getLength() == 10);
+        REQUIRE(list.getFirst() == "10");
+        REQUIRE(list.getLast() == "19");
+        REQUIRE(list.get(5) == "15");
+        REQUIRE(list.getPoolStats().used == 3);
+        list.remove(list.getLength() - 1);
+        REQUIRE(list.getLast() == "18");
+
+        REQUIRE_THROWS(list.removeIf([](const std::string& s) {
+            if (s == "15") throw std::runtime_error("predicate");
+            return s == "11" || s == "16";
+        }));
+        std::vector<std::string> left = {"10", "12", "13", "14", "15", "16", "17", "18"};
+        REQUIRE(list.getLength() == 8);
+        REQUIRE(std::equal(list.begin(), list.end(), left.begin()));
+
+        REQUIRE(list.removeIf([](const std::string&) { return true; }) == 8);
+        REQUIRE(list.getPoolStats().slabs == 0);
+        list.append("again");
+        REQUIRE(list.getFirst() == "again");
+    }
+}
+
+TEST_CASE("UnrolledLinkedList Bulk Operations Match Reference", "[UnrolledLinkedList]") {
+    UnrolledLinkedList<int, std::allocator<int>, 4> list;
+    std::vector<int> reference;
+    std::mt19937 random(17);
+
+    for (int step = 0; step < 2000; ++step) {
+        int action = random() % 3;
+        if (action == 0 || reference.empty()) {
+            int index = random() % (reference.size() + 1);
+            std::vector<int> extra(random() % 12, step);
+            list.insertRange(index, extra.begin(), extra.end());
+            reference.insert(reference.begin() + index, extra.begin(), extra.end());
+        } else if (action == 1) {
+            int start = random() % reference.size();
+            int end = start + random() % (std::min<int>(reference.size() - start, 10) + 1);
+            list.removeRange(start, end);
+            reference.erase(reference.begin() + start, reference.begin() + end);
+        } else {
+            int divisor = 2 + random() % 7;
+            list.removeIf([divisor](int x) { return x % divisor == 0; });
+            reference.erase(std::remove_if(reference.begin(), reference.end(),
+                                           [divisor](int x) { return x % divisor == 0; }),
+                            reference.end());
+        }
+        REQUIRE(list.getLength() == static_cast<int>(reference.size()));
+        if (!reference.empty()) {
+            int probe = random() % reference.size();
+            REQUIRE(list.get(probe) == reference[probe]);
+        }
+    }
+    REQUIRE(std::equal(list.begin(), list.end(), reference.begin()));
+    PoolStats stats = list.getPoolStats();
+    REQUIRE(stats.used * 4 >= list.getLength());
+}
+
+TEST_CASE("UnrolledLinkedList Fragmentation", "[UnrolledLinkedList]") {
+    UnrolledLinkedList<int, std::allocator<int>, 4> list;
+    std::mt19937 random(3);
+    for (int i = 0; i < 2000; ++i)
+        list.insertAt(i, random() % (list.getLength() + 1));
+    REQUIRE(list.getFragmentation() > 0.5);
+
+    list.compact();
+    REQUIRE(list.getFragmentation() == 0.0);
+
+    list.setCompactionThreshold(0.25);
+    for (int i = 0; i < 500; ++i) {
+        list.insertAt(i, random() % (list.getLength() + 1));
+        REQUIRE(list.getFragmentation() <= 0.25);
+    }
+
+    UnrolledLinkedList<int, std::allocator<int>, 4> assigned;
+    assigned = list;
+    for (int i = 0; i < 200; ++i)
+        assigned.insertAt(i, random() % (assigned.getLength() + 1));
+    REQUIRE(assigned.getFragmentation() <= 0.25);
+
+    std::vector<int> extra(50, 7);
+    list.insertRange(100, extra.begin(), extra.end());
+    list.removeRange(10, 400);
+    list.removeIf([](int x) { return x % 3 == 0; });
+    REQUIRE(list.getFragmentation() <= 0.25);
+}
+
+TEST_CASE("UnrolledLinkedList Bulk Operations Through Adaptors", "[UnrolledLinkedList]") {
+    std::vector<int> items = {1, 2, 3, 4, 5, 6};
+
+    UnrolledListSequence<int> sequence;
+    sequence.insertRange(0, items.begin(), items.end());
+    sequence.removeRange(1, 3);
+    REQUIRE(sequence.removeIf([](int x) { return x == 6; }) == 1);
+    REQUIRE(sequence.getLength() == 3);
+    REQUIRE(sequence.get(1) == 4);
+
+    Deque<int, UnrolledLinkedList<int>> deque;
+    deque.insertRange(0, items.begin(), items.end());
+    deque.removeRange(0, 2);
+    REQUIRE(deque.removeIf([](int x) { return x % 2 == 0; }) == 2);
+    REQUIRE(deque.popFront() == 3);
+    REQUIRE(deque.popBack() == 5);
+
+    Stack<int, UnrolledLinkedList<int>> stack;
+    stack.insertRange(0, items.begin(), items.end());
+    stack.removeRange(4, 6);
+    REQUIRE(stack.pop() == 4);
+
+    Queue<int, UnrolledLinkedList<int>> queue;
+    queue.insertRange(0, items.begin(), items.end());
+    REQUIRE(queue.removeIf([](int x) { return x < 3; }) == 2);
+    REQUIRE(queue.dequeue() == 3);
+}
+
+TEST_CASE("UnrolledLinkedList Move Assignment", "[UnrolledLinkedList]") {
+    UnrolledLinkedList<std::unique_ptr<int>> source;
+    for (int i = 0; i < 10; ++i)
+        source.emplaceBack(std::make_unique<int>(i));
+    UnrolledLinkedList<std::unique_ptr<int>> target;
+    target.emplaceBack(std::make_unique<int>(-1));
+
+    target = std::move(source);
+    REQUIRE(target.getLength() == 10);
+    REQUIRE(*target[9] == 9);
+    REQUIRE(source.getLength() == 0);
+}